@@ -40,7 +40,15 @@ set(VERILATOR_VERSION
   ${VERILATOR_VERSION_MAJOR}.${VERILATOR_VERSION_MINOR})
 message(STATUS "Found Verilator version: ${VERILATOR_VERSION}")
 
-add_library(vlib STATIC
+if (OPT_DESIGN_PLUGINS_ENABLE)
+  # Runtime is shared between the driver (or the Python bindings) and each
+  # design plugin, such that there is one instance of its global state
+  # rather than a copy in each plugin.
+  set(VLIB_TYPE SHARED)
+else ()
+  set(VLIB_TYPE STATIC)
+endif ()
+add_library(vlib ${VLIB_TYPE}
   "${VERILATOR_ROOT}/include/verilated.h"
   "${VERILATOR_ROOT}/include/verilated.cpp"
   "${VERILATOR_ROOT}/include/verilated_dpi.h"
@@ -51,6 +59,12 @@ add_library(vlib STATIC
   "${VERILATOR_ROOT}/include/verilated_threads.cpp"
   "${VERILATOR_ROOT}/include/verilated_vcd_c.h"
   "${VERILATOR_ROOT}/include/verilated_vcd_c.cpp")
+if (OPT_FUZZ_COVERAGE)
+  target_sources(vlib PRIVATE
+    "${VERILATOR_ROOT}/include/verilated_cov.h"
+    "${VERILATOR_ROOT}/include/verilated_cov.cpp")
+  target_compile_definitions(vlib PUBLIC VM_COVERAGE=1)
+endif ()
 target_include_directories(vlib PUBLIC
   "${VERILATOR_ROOT}/include"
   "${VERILATOR_ROOT}/include/vltstd")
@@ -82,6 +96,19 @@ macro(verilate design rtl_sources command_list target_out)
   if (${OPT_VCD_ENABLE})
     list(APPEND verilator_commands "--trace")
   endif ()
+  if (${CMAKE_POSITION_INDEPENDENT_CODE})
+    list(APPEND verilator_commands "-CFLAGS -fPIC")
+  endif ()
+  if (${OPT_FUZZ_ENABLE})
+    # Model must be instrumented, therefore compiled by the fuzzer's compiler.
+    list(APPEND verilator_commands "-MAKEFLAGS CXX=${CMAKE_CXX_COMPILER}")
+    if (OPT_FUZZ_ENGINE STREQUAL "libfuzzer")
+      list(APPEND verilator_commands "-CFLAGS -fsanitize=fuzzer-no-link")
+    endif ()
+    if (${OPT_FUZZ_COVERAGE})
+      list(APPEND verilator_commands "--coverage")
+    endif ()
+  endif ()
   
   # Render Verilator command file.
   file(REMOVE ${command_file})
@@ -33,15 +33,28 @@ module c #(
   parameter int W
 // Enable admission of complimented unary code
 , parameter bit P_ADMIT_COMPLIMENT_EN
+// Pipeline stages (0: combinational)
+, parameter int P_PIPE_STAGES = 0
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
   input wire logic [W - 1:0]                     i_x
+// Input vector valid, and accepted.
+, input wire logic                               i_valid
+, output wire logic                              o_ready
 
 // Admission Decision
 , output wire logic                              o_is_unary
 // Compliment form unary.
 , output wire logic                              o_is_compliment
+// Admission Decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset (of pipeline stages)
+, input wire logic                               clk
+, input wire logic                               rst
 );
 
 // Circuit to admit an arbitrary lengthed unary-/thermometer-coded bit-vector.
@@ -63,6 +76,10 @@ module c #(
 //
 //  Circuit does not admit the all-one or all-zero bitvector (respectively)
 //  as this is not considered to be a valid unary encoding. 
+//
+// Pipelining: the cells of each vector are evaluated in P_PIPE_STAGES + 1
+// chunks, separated by stage registers (see: c_v). Latency is P_PIPE_STAGES
+// cycles (see: pipe_ctrl).
 
 // ========================================================================= //
 //                                                                           //
@@ -77,23 +94,42 @@ logic                                  is_unary_v_n;
 logic                                  is_unary;
 logic                                  is_compliment;
 
+logic                                  en;
+
+// Input vector MSB, into each stage.
+logic [P_PIPE_STAGES:0]                msb_s;
+
 // ========================================================================= //
 //                                                                           //
 // Logic.                                                                    //
 //                                                                           //
 // ========================================================================= //
 
+pipe_ctrl #(.P_STAGES(P_PIPE_STAGES)) u_pipe_ctrl (
+  .i_valid                   (i_valid)
+, .o_ready                   (o_ready)
+, .o_valid                   (o_valid)
+, .i_ready                   (i_ready)
+, .o_en                      (en)
+, .clk                       (clk)
+, .rst                       (rst)
+);
+
 if (W > 1) begin : w_GEN
 
 c_v #(
   .W(W)
 , .P_IS_COMPLIMENT           (1'b0)
+, .P_PIPE_STAGES             (P_PIPE_STAGES)
 ) u_c_v(
 // Input
   .i_x                       (i_x)
 // Admission Decision
 , .o_is_unary                (is_unary_v)
 , .o_all_set                 (all_set)
+// Pipeline
+, .i_en                      (en)
+, .clk                       (clk)
 );
 
 if (P_ADMIT_COMPLIMENT_EN) begin : n_GEN
@@ -101,12 +137,16 @@ if (P_ADMIT_COMPLIMENT_EN) begin : n_GEN
 c_v #(
   .W(W)
 , .P_IS_COMPLIMENT           (1'b1)
+, .P_PIPE_STAGES             (P_PIPE_STAGES)
 ) u_c_v(
 // Input
   .i_x                       (i_x)
 // Admission Decision
 , .o_is_unary                (is_unary_v_n)
 , .o_all_set                 (all_set_n)
+// Pipeline
+, .i_en                      (en)
+, .clk                       (clk)
 );
 
   end : n_GEN
@@ -140,9 +180,26 @@ assign is_unary = (is_unary_v | is_unary_v_n) |         // (1)
                   all_set |                             // (2.1)
                   (P_ADMIT_COMPLIMENT_EN & all_set_n);  // (2.2)
 
+// ------------------------------------------------------------------------- //
+// MSB, delayed alongside the cells.
+assign msb_s[0] = i_x[W - 1];
+
+for (genvar s = 0; s < P_PIPE_STAGES; s++) begin : msb_GEN
+
+logic                                  msb_r;
+
+always_ff @(posedge clk) begin : msb_reg_PROC
+  if (en)
+    msb_r <= msb_s[s];
+end : msb_reg_PROC
+
+assign msb_s[s + 1] = msb_r;
+
+end : msb_GEN
+
 // ------------------------------------------------------------------------- //
 // is_compliment whenever configured to detect such encodings and MSB is set.
-assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
+assign is_compliment = (P_ADMIT_COMPLIMENT_EN & msb_s[P_PIPE_STAGES]);
 
 // ========================================================================= //
 //                                                                           //
@@ -153,4 +210,13 @@ assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
 assign o_is_unary = is_unary;
 assign o_is_compliment = is_compliment;
 
+// ========================================================================= //
+//                                                                           //
+// UNUSED                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+logic UNUSED__tie_off;
+assign UNUSED__tie_off = &{ en, clk };
+
 endmodule : c
@@ -33,6 +33,8 @@ module c_v #(
   parameter int W
 // Enable admission of complimented unary code
 , parameter bit P_IS_COMPLIMENT
+// Pipeline stages (0: combinational)
+, parameter int P_PIPE_STAGES = 0
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
@@ -41,8 +43,34 @@ module c_v #(
 // Admission Decision
 , output wire logic                              o_is_unary
 , output wire logic                              o_all_set
+
+// ------------------------------------------------------------------------- //
+// Stage registers advance (see: pipe_ctrl).
+, input wire logic                               i_en
+, input wire logic                               clk
 );
 
+// Pipelining: the cells are evaluated in P_PIPE_STAGES + 1 chunks (of
+// roughly W / (P_PIPE_STAGES + 1) cells, from the LSB), each but the last
+// followed by a stage register of the state of its last cell and the input
+// vector. Latency is P_PIPE_STAGES cycles.
+
+localparam int BLOCKS = P_PIPE_STAGES + 1;
+
+// Cells of chunk 'b': [block_lo(b), block_lo(b + 1)).
+function automatic int block_lo(int b);
+  return (b * W) / BLOCKS;
+endfunction
+
+// Chunk of cell 'i'.
+function automatic int block_of(int i);
+  int b_of = 0;
+  for (int b = 0; b < BLOCKS; b++)
+    if (block_lo(b) <= i)
+      b_of = b;
+  return b_of;
+endfunction
+
 // ========================================================================= //
 //                                                                           //
 // Wire(s)                                                                   //
@@ -54,6 +82,19 @@ logic [W - 1:0]                        edge_seen_v;
 logic [W - 1:0]                        all_set_v;
 logic [W - 1:0]                        is_unary_v;
 
+// Into each chunk.
+logic [BLOCKS - 1:0][W - 1:0]          x_s;
+logic [BLOCKS - 1:0]                   admit_s;
+logic [BLOCKS - 1:0]                   edge_seen_s;
+logic [BLOCKS - 1:0]                   all_set_s;
+logic [BLOCKS - 1:0]                   is_unary_s;
+
+// Out of each chunk.
+logic [BLOCKS - 1:0]                   admit_d;
+logic [BLOCKS - 1:0]                   edge_seen_d;
+logic [BLOCKS - 1:0]                   all_set_d;
+logic [BLOCKS - 1:0]                   is_unary_d;
+
 logic                                  all_set;
 logic                                  is_unary;
 
@@ -63,17 +104,23 @@ logic                                  is_unary;
 //                                                                           //
 // ========================================================================= //
 
+assign x_s[0] = i_x;
+assign admit_s[0] = 1'b1;
+assign edge_seen_s[0] = 1'b0;
+assign all_set_s[0] = 1'b0;
+assign is_unary_s[0] = 1'b0;
+
 c_v_cell #(
   .P_IS_FIRST                (1'b1)
 , .P_IS_COMPLIMENT           (P_IS_COMPLIMENT)
 ) u_c_v_cell(
 // Input
-  .i_x                       (i_x[0])
+  .i_x                       (x_s[0][0])
 , .i_x_prev                  (1'b0)
 // Prior State
-, .i_prior_admit             (1'b1)
-, .i_prior_edge_seen         (1'b0)
-, .i_prior_all_set           (1'b0)
+, .i_prior_admit             (admit_s[0])
+, .i_prior_edge_seen         (edge_seen_s[0])
+, .i_prior_all_set           (all_set_s[0])
 // Future State
 , .o_admit                   (admit_v[0])
 , .o_edge_seen               (edge_seen_v[0])
@@ -84,17 +131,35 @@ c_v_cell #(
 
 for (genvar i = 1; i < W; i++) begin : cell_GEN
 
+localparam int B = block_of(i);
+
+logic                                  prior_admit;
+logic                                  prior_edge_seen;
+logic                                  prior_all_set;
+
+// The first cell of a chunk continues from the stage register.
+if (i == block_lo(B)) begin : first_GEN
+  assign prior_admit = admit_s[B];
+  assign prior_edge_seen = edge_seen_s[B];
+  assign prior_all_set = all_set_s[B];
+end : first_GEN
+else begin : next_GEN
+  assign prior_admit = admit_v[i - 1];
+  assign prior_edge_seen = edge_seen_v[i - 1];
+  assign prior_all_set = all_set_v[i - 1];
+end : next_GEN
+
 c_v_cell #(
   .P_IS_FIRST                (1'b0)
 , .P_IS_COMPLIMENT           (P_IS_COMPLIMENT)
 ) u_c_v_cell (
 // Input
-  .i_x                       (i_x[i])
-, .i_x_prev                  (i_x[i - 1])
+  .i_x                       (x_s[B][i])
+, .i_x_prev                  (x_s[B][i - 1])
 // Prior State
-, .i_prior_admit             (admit_v[i - 1])
-, .i_prior_edge_seen         (edge_seen_v[i - 1])
-, .i_prior_all_set           (all_set_v[i - 1])
+, .i_prior_admit             (prior_admit)
+, .i_prior_edge_seen         (prior_edge_seen)
+, .i_prior_all_set           (prior_all_set)
 // Future State
 , .o_admit                   (admit_v[i])
 , .o_edge_seen               (edge_seen_v[i])
@@ -105,9 +170,54 @@ c_v_cell #(
 
 end : cell_GEN
 
-assign all_set = all_set_v[W - 1];
-
-assign is_unary = is_unary_v[W - 1];
+for (genvar b = 0; b < BLOCKS; b++) begin : block_GEN
+
+// State of the last cell of the chunk; an empty chunk passes that of the
+// prior chunk.
+if (block_lo(b) < block_lo(b + 1)) begin : cells_GEN
+  assign admit_d[b] = admit_v[block_lo(b + 1) - 1];
+  assign edge_seen_d[b] = edge_seen_v[block_lo(b + 1) - 1];
+  assign all_set_d[b] = all_set_v[block_lo(b + 1) - 1];
+  assign is_unary_d[b] = is_unary_v[block_lo(b + 1) - 1];
+end : cells_GEN
+else begin : empty_GEN
+  assign admit_d[b] = admit_s[b];
+  assign edge_seen_d[b] = edge_seen_s[b];
+  assign all_set_d[b] = all_set_s[b];
+  assign is_unary_d[b] = is_unary_s[b];
+end : empty_GEN
+
+if (b < P_PIPE_STAGES) begin : stage_GEN
+
+logic [W - 1:0]                        x_r;
+logic                                  admit_r;
+logic                                  edge_seen_r;
+logic                                  all_set_r;
+logic                                  is_unary_r;
+
+always_ff @(posedge clk) begin : stage_reg_PROC
+  if (i_en) begin
+    x_r <= x_s[b];
+    admit_r <= admit_d[b];
+    edge_seen_r <= edge_seen_d[b];
+    all_set_r <= all_set_d[b];
+    is_unary_r <= is_unary_d[b];
+  end
+end : stage_reg_PROC
+
+assign x_s[b + 1] = x_r;
+assign admit_s[b + 1] = admit_r;
+assign edge_seen_s[b + 1] = edge_seen_r;
+assign all_set_s[b + 1] = all_set_r;
+assign is_unary_s[b + 1] = is_unary_r;
+
+end : stage_GEN
+
+end : block_GEN
+
+assign all_set = all_set_d[BLOCKS - 1];
+
+assign is_unary = is_unary_d[BLOCKS - 1];
 
 // ========================================================================= //
 //                                                                           //
@@ -125,9 +235,13 @@ assign o_all_set = all_set;
 // ========================================================================= //
 
 logic UNUSED__tie_off;
-assign UNUSED__tie_off = &{ is_unary_v[W - 2:0],
-                            edge_seen_v[W - 1],
-                            admit_v[W - 1]
+assign UNUSED__tie_off = &{ is_unary_v,
+                            edge_seen_d[BLOCKS - 1],
+                            admit_d[BLOCKS - 1],
+                            x_s,
+                            is_unary_s,
+                            i_en,
+                            clk
                           };
 
 endmodule : c_v
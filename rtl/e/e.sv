@@ -33,15 +33,30 @@ module e #(
   parameter int W
 // Enable admission of complimented unary code
 , parameter bit P_ADMIT_COMPLIMENT_EN
+// Pipeline stages (0: combinational)
+, parameter int P_PIPE_STAGES = 0
+// One-hot detection by reduction tree (otherwise, matrix; see: e_is_1hot)
+, parameter bit P_1HOT_TREE_EN = 1'b0
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
   input wire logic [W - 1:0]                     i_x
+// Input vector valid, and accepted.
+, input wire logic                               i_valid
+, output wire logic                              o_ready
 
 // Admission Decision
 , output wire logic                              o_is_unary
 // Compliment form unary.
 , output wire logic                              o_is_compliment
+// Admission Decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset (of pipeline stages)
+, input wire logic                               clk
+, input wire logic                               rst
 );
 
 // Circuit to admit an arbitrary lengthed unary-/thermometer-coded bit-vector.
@@ -63,6 +78,23 @@ module e #(
 //
 //  Circuit does not admit the all-one or all-zero bitvector (respectively)
 //  as this is not considered to be a valid unary encoding. 
+//
+// Pipelining: the edge vector is reduced by a tree of 2^P_PIPE_STAGES
+// leaves (each of roughly W / 2^P_PIPE_STAGES edges), whose nodes record
+// whether any, or more than one, edge is present, and whether the bits
+// spanned are all-zero or all-one. A stage register follows the leaves and
+// each level of the tree but the last (the root). Latency is P_PIPE_STAGES
+// cycles (see: pipe_ctrl).
+
+localparam int LEAVES = (1 << P_PIPE_STAGES);
+
+// Edges of the widest leaf.
+localparam int LEAF_W = (W + LEAVES - 1) / LEAVES;
+
+// Bits of leaf 'k': [leaf_lo(k), leaf_lo(k + 1)).
+function automatic int leaf_lo(int k);
+  return (k * W) / LEAVES;
+endfunction
 
 // ========================================================================= //
 //                                                                           //
@@ -70,7 +102,21 @@ module e #(
 //                                                                           //
 // ========================================================================= //
 
+logic                                  en;
+
 logic [W - 1:0]                        edge_v;
+
+// Nodes at each level of the tree (level 0: the leaves; level
+// P_PIPE_STAGES: the root), of which level 'l' has LEAVES >> l.
+logic [P_PIPE_STAGES:0][LEAVES - 1:0]  has_edge_d;
+logic [P_PIPE_STAGES:0][LEAVES - 1:0]  has_edges_d;
+logic [P_PIPE_STAGES:0][LEAVES - 1:0]  all_clr_d;
+logic [P_PIPE_STAGES:0][LEAVES - 1:0]  all_set_d;
+
+// Input vector LSB and MSB, into each level.
+logic [P_PIPE_STAGES:0]                lsb_s;
+logic [P_PIPE_STAGES:0]                msb_s;
+
 logic                                  has_one_edge;
 logic                                  is_unary;
 logic                                  is_compliment;
@@ -81,15 +127,114 @@ logic                                  is_compliment;
 //                                                                           //
 // ========================================================================= //
 
+pipe_ctrl #(.P_STAGES(P_PIPE_STAGES)) u_pipe_ctrl (
+  .i_valid              (i_valid)
+, .o_ready              (o_ready)
+, .o_valid              (o_valid)
+, .i_ready              (i_ready)
+, .o_en                 (en)
+, .clk                  (clk)
+, .rst                  (rst)
+);
+
 for (genvar i = 0; i < W; i++) begin : edge_GEN
 
 assign edge_v[i] = (i == 0) ? 1'b0 : (i_x[i] ^ i_x[i - 1]);
 
 end : edge_GEN
 
+// ------------------------------------------------------------------------- //
+// Leaves: edges (and bits) of each span.
+//
+for (genvar k = 0; k < LEAVES; k++) begin : leaf_GEN
+
+logic [LEAF_W - 1:0]                   leaf_edge_v;
+logic [LEAF_W - 1:0]                   leaf_clr_v;
+logic [LEAF_W - 1:0]                   leaf_set_v;
+logic                                  leaf_is_1hot;
+
+for (genvar i = 0; i < LEAF_W; i++) begin : bit_GEN
+
+if ((leaf_lo(k) + i) < leaf_lo(k + 1)) begin : in_GEN
+  assign leaf_edge_v[i] = edge_v[leaf_lo(k) + i];
+  assign leaf_clr_v[i] = ~i_x[leaf_lo(k) + i];
+  assign leaf_set_v[i] = i_x[leaf_lo(k) + i];
+end : in_GEN
+else begin : pad_GEN
+  assign leaf_edge_v[i] = 1'b0;
+  assign leaf_clr_v[i] = 1'b1;
+  assign leaf_set_v[i] = 1'b1;
+end : pad_GEN
+
+end : bit_GEN
+
 // Edge vector should be one-hot if there is one transition across
 // the entire vector.
-e_is_1hot #(.W(W)) u_e_is_1hot (.i_x(edge_v), .o_is_1hot(has_one_edge));
+e_is_1hot #(.W(LEAF_W), .P_TREE_EN(P_1HOT_TREE_EN)) u_e_is_1hot (
+  .i_x(leaf_edge_v), .o_is_1hot(leaf_is_1hot));
+
+assign has_edge_d[0][k] = (leaf_edge_v != '0);
+assign has_edges_d[0][k] = (leaf_edge_v != '0) & (~leaf_is_1hot);
+assign all_clr_d[0][k] = (leaf_clr_v == '1);
+assign all_set_d[0][k] = (leaf_set_v == '1);
+
+end : leaf_GEN
+
+assign lsb_s[0] = i_x[0];
+assign msb_s[0] = i_x[W - 1];
+
+// ------------------------------------------------------------------------- //
+// Levels: each node combines a pair of the (registered) level below.
+//
+for (genvar l = 1; l <= P_PIPE_STAGES; l++) begin : level_GEN
+
+// Nodes of the level below.
+localparam int NODES = (LEAVES >> (l - 1));
+
+logic [NODES - 1:0]                    has_edge_r;
+logic [NODES - 1:0]                    has_edges_r;
+logic [NODES - 1:0]                    all_clr_r;
+logic [NODES - 1:0]                    all_set_r;
+logic                                  lsb_r;
+logic                                  msb_r;
+
+always_ff @(posedge clk) begin : stage_reg_PROC
+  if (en) begin
+    has_edge_r <= has_edge_d[l - 1][NODES - 1:0];
+    has_edges_r <= has_edges_d[l - 1][NODES - 1:0];
+    all_clr_r <= all_clr_d[l - 1][NODES - 1:0];
+    all_set_r <= all_set_d[l - 1][NODES - 1:0];
+    lsb_r <= lsb_s[l - 1];
+    msb_r <= msb_s[l - 1];
+  end
+end : stage_reg_PROC
+
+assign lsb_s[l] = lsb_r;
+assign msb_s[l] = msb_r;
+
+for (genvar k = 0; k < LEAVES; k++) begin : node_GEN
+
+if (k < (LEAVES >> l)) begin : in_GEN
+  assign has_edge_d[l][k] = has_edge_r[2 * k] | has_edge_r[2 * k + 1];
+  // More than one edge in either, or one in each.
+  assign has_edges_d[l][k] = has_edges_r[2 * k] | has_edges_r[2 * k + 1] |
+                             (has_edge_r[2 * k] & has_edge_r[2 * k + 1]);
+  assign all_clr_d[l][k] = all_clr_r[2 * k] & all_clr_r[2 * k + 1];
+  assign all_set_d[l][k] = all_set_r[2 * k] & all_set_r[2 * k + 1];
+end : in_GEN
+else begin : none_GEN
+  assign has_edge_d[l][k] = 1'b0;
+  assign has_edges_d[l][k] = 1'b0;
+  assign all_clr_d[l][k] = 1'b0;
+  assign all_set_d[l][k] = 1'b0;
+end : none_GEN
+
+end : node_GEN
+
+end : level_GEN
+
+assign has_one_edge = has_edge_d[P_PIPE_STAGES][0] &
+                      (~has_edges_d[P_PIPE_STAGES][0]);
 
 // Vector is unary iff:
 //
@@ -102,12 +247,13 @@ e_is_1hot #(.W(W)) u_e_is_1hot (.i_x(edge_v), .o_is_1hot(has_one_edge));
 //       case is present.
 //
 assign is_unary =
-  (has_one_edge & (i_x[0] | (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]))) |  // (1)
-  (i_x == '0) |                                                       // (2.1)
-  (P_ADMIT_COMPLIMENT_EN & (i_x == '1));                              // (2.2)
+  (has_one_edge & (lsb_s[P_PIPE_STAGES] |
+                   (P_ADMIT_COMPLIMENT_EN & msb_s[P_PIPE_STAGES]))) |  // (1)
+  all_clr_d[P_PIPE_STAGES][0] |                                        // (2.1)
+  (P_ADMIT_COMPLIMENT_EN & all_set_d[P_PIPE_STAGES][0]);               // (2.2)
 
 // is_compliment whenever configured to detect such encodings and MSB is set.
-assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
+assign is_compliment = (P_ADMIT_COMPLIMENT_EN & msb_s[P_PIPE_STAGES]);
 
 // ========================================================================= //
 //                                                                           //
@@ -118,4 +264,19 @@ assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
 assign o_is_unary = is_unary;
 assign o_is_compliment = is_compliment;
 
+// ========================================================================= //
+//                                                                           //
+// UNUSED                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+// Nodes beyond the root, and beyond the width of each level.
+logic UNUSED__tie_off;
+assign UNUSED__tie_off = &{ en,
+                            has_edge_d,
+                            has_edges_d,
+                            all_clr_d,
+                            all_set_d
+                          };
+
 endmodule : e
@@ -31,6 +31,8 @@ module e_is_1hot #(
 // ------------------------------------------------------------------------- //
 // Bit-Width
   parameter int W
+// Reduction tree (otherwise, matrix) realization
+, parameter bit P_TREE_EN = 1'b0
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
@@ -40,14 +42,22 @@ module e_is_1hot #(
 , output wire logic                              o_is_1hot
 );
 
+// Matrix: each bit is matched against the vector with only that bit set;
+// O(W^2) area, O(log W) depth.
+//
+// Tree: a binary tree whose nodes combine, from their children, whether any
+// bit, and whether more than one bit, is set below them; O(W) area, O(log W)
+// depth. The input is padded (with zeros) to a power-of-two number of
+// leaves.
+
+localparam int LEAVES = 1 << $clog2(W);
+
 // ========================================================================= //
 //                                                                           //
 // Wire(s)                                                                   //
 //                                                                           //
 // ========================================================================= //
 
-logic [W - 1:0][W - 1:0]               x_matrix;
-logic [W - 1:0]                        y;
 logic                                  is_1hot;
 
 // ========================================================================= //
@@ -56,6 +66,42 @@ logic                                  is_1hot;
 //                                                                           //
 // ========================================================================= //
 
+if (P_TREE_EN) begin : tree_GEN
+
+// Node 'n' has children 2n and 2n + 1; the root is node 1, and leaf 'i' is
+// node LEAVES + i.
+logic [2 * LEAVES - 1:1]               any;
+logic [2 * LEAVES - 1:1]               many;
+
+for (genvar i = 0; i < LEAVES; i++) begin : leaf_GEN
+
+if (i < W) begin : bit_GEN
+  assign any[LEAVES + i] = i_x[i];
+end : bit_GEN
+else begin : pad_GEN
+  assign any[LEAVES + i] = 1'b0;
+end : pad_GEN
+
+assign many[LEAVES + i] = 1'b0;
+
+end : leaf_GEN
+
+for (genvar n = 1; n < LEAVES; n++) begin : node_GEN
+
+assign any[n] = any[2 * n] | any[2 * n + 1];
+assign many[n] = many[2 * n] | many[2 * n + 1] |
+                 (any[2 * n] & any[2 * n + 1]);
+
+end : node_GEN
+
+assign is_1hot = any[1] & (~many[1]);
+
+end : tree_GEN
+else begin : matrix_GEN
+
+logic [W - 1:0][W - 1:0]               x_matrix;
+logic [W - 1:0]                        y;
+
 // ------------------------------------------------------------------------- //
 //
 for (genvar j = 0; j < W; j++) begin : x_matrix_j_GEN
@@ -80,6 +126,8 @@ end : y_i_GEN
 //
 assign is_1hot = (y != '0);
 
+end : matrix_GEN
+
 // ========================================================================= //
 //                                                                           //
 // Output(s)                                                                 //
@@ -33,15 +33,30 @@ module o #(
   parameter int W
 // Enable admission of complimented unary code
 , parameter bit P_ADMIT_COMPLIMENT_EN
+// Pipeline stages (0: combinational)
+, parameter int P_PIPE_STAGES = 0
+// Carry architecture of the increments (see: prefix_pkg::arch_t)
+, parameter int P_ADDER_ARCH = prefix_pkg::ARCH_INFERRED
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
   input wire logic [W - 1:0]                     i_x
+// Input vector valid, and accepted.
+, input wire logic                               i_valid
+, output wire logic                              o_ready
 
 // Admission Decision
 , output wire logic                              o_is_unary
 // Compliment form unary.
 , output wire logic                              o_is_compliment
+// Admission Decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset (of pipeline stages)
+, input wire logic                               clk
+, input wire logic                               rst
 );
 
 // Circuit to admit an arbitrary lengthed unary-/thermometer-coded bit-vector.
@@ -63,6 +78,21 @@ module o #(
 //
 //  Circuit does not admit the all-one or all-zero bitvector (respectively)
 //  as this is not considered to be a valid unary encoding. 
+//
+// Pipelining: the increments are computed in P_PIPE_STAGES + 1 carry blocks
+// (of roughly W / (P_PIPE_STAGES + 1) bits, from the LSB), each but the last
+// followed by a stage register of its carry-outs, the decisions so far and
+// the input vector. Latency is P_PIPE_STAGES cycles (see: pipe_ctrl).
+//
+// Carry architecture: each block's increments are computed by prefix_inc,
+// whose carry network is selected by P_ADDER_ARCH.
+
+localparam int BLOCKS = P_PIPE_STAGES + 1;
+
+// Bits of carry block 'b': [block_lo(b), block_lo(b + 1)).
+function automatic int block_lo(int b);
+  return (b * W) / BLOCKS;
+endfunction
 
 // ========================================================================= //
 //                                                                           //
@@ -70,6 +100,21 @@ module o #(
 //                                                                           //
 // ========================================================================= //
 
+logic                        en;
+
+// Into each carry block.
+logic [BLOCKS - 1:0][W - 1:0] x_s;
+logic [BLOCKS - 1:0]         carry_nc_s;
+logic [BLOCKS - 1:0]         is_unary_nc_s;
+logic [BLOCKS - 1:0]         carry_c_s;
+logic [BLOCKS - 1:0]         is_unary_c_s;
+
+// Out of each carry block.
+logic [BLOCKS - 1:0]         carry_nc_d;
+logic [BLOCKS - 1:0]         is_unary_nc_d;
+logic [BLOCKS - 1:0]         carry_c_d;
+logic [BLOCKS - 1:0]         is_unary_c_d;
+
 logic                        is_unary_nc;
 logic                        is_unary_c;
 logic                        is_compliment;
@@ -80,6 +125,35 @@ logic                        is_compliment;
 //                                                                           //
 // ========================================================================= //
 
+pipe_ctrl #(.P_STAGES(P_PIPE_STAGES)) u_pipe_ctrl (
+  .i_valid              (i_valid)
+, .o_ready              (o_ready)
+, .o_valid              (o_valid)
+, .i_ready              (i_ready)
+, .o_en                 (en)
+, .clk                  (clk)
+, .rst                  (rst)
+);
+
+// Increment: carry-in of the first block.
+assign x_s[0] = i_x;
+assign carry_nc_s[0] = 1'b1;
+assign is_unary_nc_s[0] = 1'b1;
+assign carry_c_s[0] = 1'b1;
+assign is_unary_c_s[0] = 1'b1;
+
+for (genvar b = 0; b < BLOCKS; b++) begin : block_GEN
+
+localparam int LO = block_lo(b);
+localparam int BW = block_lo(b + 1) - LO;
+
+if (BW > 0) begin : inc_GEN
+
+logic [BW - 1:0]             x_nc;
+logic [BW - 1:0]             y_nc;
+logic [BW - 1:0]             x_c;
+logic [BW - 1:0]             y_c;
+
 // ------------------------------------------------------------------------- //
 // Unary is no overlap between i_x and its increment.
 //
@@ -89,13 +163,86 @@ logic                        is_compliment;
 //
 //   not-unary -  'b00101001 -> 'b00101010 & 'b00101001 = 'b00101000
 //
-assign is_unary_nc = ((i_x + 'b1) & i_x) == '0;
+// Within the block, the increment is of its bits plus the carry-in; the
+// carry propagates through a block of all-ones.
+//
+assign x_nc = x_s[b][LO +: BW];
+
+prefix_inc #(.W(BW), .P_ARCH(P_ADDER_ARCH)) u_inc_nc (
+  .i_x                  (x_nc)
+, .i_ci                 (carry_nc_s[b])
+, .o_y                  (y_nc)
+, .o_co                 (carry_nc_d[b])
+);
+
+assign is_unary_nc_d[b] = is_unary_nc_s[b] & ((y_nc & x_nc) == '0);
+
+// ------------------------------------------------------------------------- //
+// Similarly, complimented unary is no overlap between the inverse of i_x
+// and its increment.
+//
+//   unary     -  'b11100000 -> ~: 'b00011111 -> 'b00100000 & 'b00011111 = 'b0
+//
+assign x_c = ~x_nc;
+
+prefix_inc #(.W(BW), .P_ARCH(P_ADDER_ARCH)) u_inc_c (
+  .i_x                  (x_c)
+, .i_ci                 (carry_c_s[b])
+, .o_y                  (y_c)
+, .o_co                 (carry_c_d[b])
+);
+
+assign is_unary_c_d[b] = is_unary_c_s[b] & ((y_c & x_c) == '0);
+
+end : inc_GEN
+else begin : empty_GEN
+
+// No bits (where there are more blocks than bits); pass through.
+assign is_unary_nc_d[b] = is_unary_nc_s[b];
+assign carry_nc_d[b] = carry_nc_s[b];
+assign is_unary_c_d[b] = is_unary_c_s[b];
+assign carry_c_d[b] = carry_c_s[b];
+
+end : empty_GEN
+
+if (b < P_PIPE_STAGES) begin : stage_GEN
+
+logic [W - 1:0]              x_r;
+logic                        carry_nc_r;
+logic                        is_unary_nc_r;
+logic                        carry_c_r;
+logic                        is_unary_c_r;
+
+always_ff @(posedge clk) begin : stage_reg_PROC
+  if (en) begin
+    x_r <= x_s[b];
+    carry_nc_r <= carry_nc_d[b];
+    is_unary_nc_r <= is_unary_nc_d[b];
+    carry_c_r <= carry_c_d[b];
+    is_unary_c_r <= is_unary_c_d[b];
+  end
+end : stage_reg_PROC
+
+assign x_s[b + 1] = x_r;
+assign carry_nc_s[b + 1] = carry_nc_r;
+assign is_unary_nc_s[b + 1] = is_unary_nc_r;
+assign carry_c_s[b + 1] = carry_c_r;
+assign is_unary_c_s[b + 1] = is_unary_c_r;
+
+end : stage_GEN
+
+end : block_GEN
+
+// The all-ones vector has no overlap with its increment, but is the
+// complimented form (of 0); admit it only as such.
+assign is_unary_nc = is_unary_nc_d[BLOCKS - 1] &
+                     (P_ADMIT_COMPLIMENT_EN | (~x_s[BLOCKS - 1][W - 1]));
 
 // ------------------------------------------------------------------------- //
 //
 if (P_ADMIT_COMPLIMENT_EN) begin: admit_c_GEN
-  assign is_unary_c = (((~i_x) + 'b1) & i_x) == '0;
-  assign is_compliment = i_x[W - 1];
+  assign is_unary_c = is_unary_c_d[BLOCKS - 1];
+  assign is_compliment = x_s[BLOCKS - 1][W - 1];
 end: admit_c_GEN
 else begin: no_admit_c_GEN
   assign is_unary_c = 'b0;
@@ -111,4 +258,17 @@ end: no_admit_c_GEN
 assign o_is_unary = (is_unary_nc | is_unary_c);
 assign o_is_compliment = is_compliment;
 
+// ========================================================================= //
+//                                                                           //
+// UNUSED                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+logic UNUSED__tie_off;
+assign UNUSED__tie_off = &{ en,
+                            carry_nc_d[BLOCKS - 1],
+                            carry_c_d[BLOCKS - 1],
+                            is_unary_c_d[BLOCKS - 1]
+                          };
+
 endmodule : o
@@ -33,15 +33,32 @@ module p #(
   parameter int W
 // Enable admission of complimented unary code
 , parameter bit P_ADMIT_COMPLIMENT_EN
+// Pipeline stages (0: combinational)
+, parameter int P_PIPE_STAGES = 0
+// Carry architecture of the increment (see: prefix_pkg::arch_t)
+, parameter int P_ADDER_ARCH = prefix_pkg::ARCH_INFERRED
+// One-hot detection by reduction tree (otherwise, matrix; see: p_is_1hot)
+, parameter bit P_1HOT_TREE_EN = 1'b0
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
   input wire logic [W - 1:0]                     i_x
+// Input vector valid, and accepted.
+, input wire logic                               i_valid
+, output wire logic                              o_ready
 
 // Admission Decision
 , output wire logic                              o_is_unary
 // Compliment form unary.
 , output wire logic                              o_is_compliment
+// Admission Decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset (of pipeline stages)
+, input wire logic                               clk
+, input wire logic                               rst
 );
 
 // Circuit to admit an arbitrary lengthed unary-/thermometer-coded bit-vector.
@@ -63,6 +80,26 @@ module p #(
 //
 //  Circuit does not admit the all-one or all-zero bitvector (respectively)
 //  as this is not considered to be a valid unary encoding. 
+//
+// Pipelining: the increment is computed in P_PIPE_STAGES + 1 carry blocks
+// (of roughly W / (P_PIPE_STAGES + 1) bits, from the LSB), each of whose
+// result is checked for set bits as it is produced. Each block but the last
+// is followed by a stage register of its carry-out, whether no, or exactly
+// one, bit has been set so far, and the input vector. Latency is
+// P_PIPE_STAGES cycles (see: pipe_ctrl).
+//
+// Carry architecture: each block's increment is computed by prefix_inc,
+// whose carry network is selected by P_ADDER_ARCH.
+
+localparam int BLOCKS = P_PIPE_STAGES + 1;
+
+// Bits of the widest carry block.
+localparam int BLOCK_W = (W + BLOCKS - 1) / BLOCKS;
+
+// Bits of carry block 'b': [block_lo(b), block_lo(b + 1)).
+function automatic int block_lo(int b);
+  return (b * W) / BLOCKS;
+endfunction
 
 // ========================================================================= //
 //                                                                           //
@@ -70,9 +107,20 @@ module p #(
 //                                                                           //
 // ========================================================================= //
 
-logic [W - 1:0]                        x_inv;
-logic [W - 1:0]                        y_inc;
-logic                                  UNUSED__y_inc_cout;
+logic                                  en;
+
+// Into each carry block.
+logic [BLOCKS - 1:0][W - 1:0]          x_s;
+logic [BLOCKS - 1:0]                   carry_s;
+logic [BLOCKS - 1:0]                   is_0hot_s;
+logic [BLOCKS - 1:0]                   is_1hot_s;
+
+// Out of each carry block.
+logic [BLOCKS - 1:0]                   carry_d;
+logic [BLOCKS - 1:0]                   is_0hot_d;
+logic [BLOCKS - 1:0]                   is_1hot_d;
+
+logic                                  msb;
 logic                                  is_1hot;
 logic                                  is_unary;
 logic                                  is_compliment;
@@ -83,6 +131,36 @@ logic                                  is_compliment;
 //                                                                           //
 // ========================================================================= //
 
+pipe_ctrl #(.P_STAGES(P_PIPE_STAGES)) u_pipe_ctrl (
+  .i_valid              (i_valid)
+, .o_ready              (o_ready)
+, .o_valid              (o_valid)
+, .i_ready              (i_ready)
+, .o_en                 (en)
+, .clk                  (clk)
+, .rst                  (rst)
+);
+
+// Increment: carry-in of the first block.
+assign x_s[0] = i_x;
+assign carry_s[0] = 1'b1;
+assign is_0hot_s[0] = 1'b1;
+assign is_1hot_s[0] = 1'b0;
+
+for (genvar b = 0; b < BLOCKS; b++) begin : block_GEN
+
+localparam int LO = block_lo(b);
+localparam int BW = block_lo(b + 1) - LO;
+
+logic [BLOCK_W - 1:0]                  y_inc_block;
+logic                                  block_is_0hot;
+logic                                  block_is_1hot;
+
+if (BW > 0) begin : inc_GEN
+
+logic [BW - 1:0]                       x_inv;
+logic [BW - 1:0]                       y_inc;
+
 // ------------------------------------------------------------------------- //
 // When ADMIT_COMPLIMENT, conditionally invert input to convert complimented
 // encoding to normal-form.
@@ -91,7 +169,8 @@ logic                                  is_compliment;
 //
 // Normal-form unary encoding:  000000011111111111
 //
-assign x_inv = P_ADMIT_COMPLIMENT_EN ? ({W{i_x[W - 1]}} ^ i_x) : i_x;
+assign x_inv = P_ADMIT_COMPLIMENT_EN ?
+                 ({BW{x_s[b][W - 1]}} ^ x_s[b][LO +: BW]) : x_s[b][LO +: BW];
 
 // ------------------------------------------------------------------------- //
 // Increment vector to produce one-one:
@@ -100,22 +179,87 @@ assign x_inv = P_ADMIT_COMPLIMENT_EN ? ({W{i_x[W - 1]}} ^ i_x) : i_x;
 //
 //  Incremented: 000000100000000000
 //
-assign {UNUSED__y_inc_cout, y_inc} = (x_inv + 'b1);
+// Within the block, the increment is of its bits plus the carry-in; the
+// carry propagates through a block of all-ones (and, from the last block,
+// is discarded).
+//
+prefix_inc #(.W(BW), .P_ARCH(P_ADDER_ARCH)) u_inc (
+  .i_x                  (x_inv)
+, .i_ci                 (carry_s[b])
+, .o_y                  (y_inc)
+, .o_co                 (carry_d[b])
+);
+
+for (genvar i = 0; i < BLOCK_W; i++) begin : y_inc_block_GEN
+
+if (i < BW) begin : bit_GEN
+  assign y_inc_block[i] = y_inc[i];
+end : bit_GEN
+else begin : pad_GEN
+  assign y_inc_block[i] = 1'b0;
+end : pad_GEN
+
+end : y_inc_block_GEN
+
+end : inc_GEN
+else begin : empty_GEN
+
+// No bits (where there are more blocks than bits); pass through.
+assign y_inc_block = '0;
+assign carry_d[b] = carry_s[b];
+
+end : empty_GEN
 
 // ------------------------------------------------------------------------- //
 // Detect whether result of increment is 1hot, indicating that original
-// word was unary encoded.
+// word was unary encoded: 1hot so far, and no bits set in this block; or
+// no bits set so far, and this block 1hot.
 //
-p_is_1hot #(.W(W)) u_p_is_1hot (.i_x(y_inc), .o_is_1hot(is_1hot));
+p_is_1hot #(.W(BLOCK_W), .P_TREE_EN(P_1HOT_TREE_EN)) u_p_is_1hot (
+  .i_x(y_inc_block), .o_is_1hot(block_is_1hot));
+
+assign block_is_0hot = (y_inc_block == '0);
+
+assign is_0hot_d[b] = is_0hot_s[b] & block_is_0hot;
+assign is_1hot_d[b] = (is_1hot_s[b] & block_is_0hot) |
+                      (is_0hot_s[b] & block_is_1hot);
+
+if (b < P_PIPE_STAGES) begin : stage_GEN
+
+logic [W - 1:0]                        x_r;
+logic                                  carry_r;
+logic                                  is_0hot_r;
+logic                                  is_1hot_r;
+
+always_ff @(posedge clk) begin : stage_reg_PROC
+  if (en) begin
+    x_r <= x_s[b];
+    carry_r <= carry_d[b];
+    is_0hot_r <= is_0hot_d[b];
+    is_1hot_r <= is_1hot_d[b];
+  end
+end : stage_reg_PROC
+
+assign x_s[b + 1] = x_r;
+assign carry_s[b + 1] = carry_r;
+assign is_0hot_s[b + 1] = is_0hot_r;
+assign is_1hot_s[b + 1] = is_1hot_r;
+
+end : stage_GEN
+
+end : block_GEN
+
+assign msb = x_s[BLOCKS - 1][W - 1];
+assign is_1hot = is_1hot_d[BLOCKS - 1];
 
 // ------------------------------------------------------------------------- //
 // is_unary iff result of increment is 1-hot and, either the original
 // word a normal-form unary encoding format, or not an we are configured
 // to admit complimented forms.
 //
-assign is_unary = is_1hot & (P_ADMIT_COMPLIMENT_EN | ~i_x[W - 1]);
+assign is_unary = is_1hot & (P_ADMIT_COMPLIMENT_EN | ~msb);
 
-assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
+assign is_compliment = (P_ADMIT_COMPLIMENT_EN & msb);
 
 // ========================================================================= //
 //                                                                           //
@@ -126,4 +270,16 @@ assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
 assign o_is_unary = is_unary;
 assign o_is_compliment = is_compliment;
 
+// ========================================================================= //
+//                                                                           //
+// UNUSED                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+logic UNUSED__tie_off;
+assign UNUSED__tie_off = &{ en,
+                            carry_d[BLOCKS - 1],
+                            is_0hot_d[BLOCKS - 1]
+                          };
+
 endmodule : p
@@ -0,0 +1,130 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+`include "common_defs.vh"
+
+module pipe_ctrl #(
+// ------------------------------------------------------------------------- //
+// Pipeline stages (0: combinational)
+  parameter int P_STAGES = 0
+) (
+// ------------------------------------------------------------------------- //
+// Upstream: vector valid, and accepted.
+  input wire logic                               i_valid
+, output wire logic                              o_ready
+
+// ------------------------------------------------------------------------- //
+// Downstream: decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Stage registers advance.
+, output wire logic                              o_en
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset
+, input wire logic                               clk
+, input wire logic                               rst
+);
+
+// Valid/ready control of a P_STAGES deep pipeline, whose (data) stage
+// registers are enabled by 'o_en'. The pipeline advances as a whole unless
+// a valid decision is presented but not accepted, in which case all stages
+// stall. An accepted vector is therefore presented (as a decision) exactly
+// P_STAGES cycles later, absent stalls. Where P_STAGES is 0, valid and
+// ready pass through; ready is then independent of valid, such that the
+// handshake introduces no combinational valid to ready path.
+
+// ========================================================================= //
+//                                                                           //
+// Wire(s)                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+// Valid into each stage; valid_s[P_STAGES] is that of the decision.
+logic [P_STAGES:0]                     valid_s;
+logic                                  en;
+
+// ========================================================================= //
+//                                                                           //
+// Logic.                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+assign valid_s[0] = i_valid;
+
+if (P_STAGES == 0) begin : comb_en_GEN
+
+assign en = i_ready;
+
+end : comb_en_GEN
+else begin : pipe_en_GEN
+
+assign en = (~valid_s[P_STAGES]) | i_ready;
+
+end : pipe_en_GEN
+
+for (genvar s = 0; s < P_STAGES; s++) begin : stage_GEN
+
+logic                                  valid_r;
+
+always_ff @(posedge clk) begin : valid_reg_PROC
+  if (rst)
+    valid_r <= 1'b0;
+  else if (en)
+    valid_r <= valid_s[s];
+end : valid_reg_PROC
+
+assign valid_s[s + 1] = valid_r;
+
+end : stage_GEN
+
+// ========================================================================= //
+//                                                                           //
+// Output(s)                                                                 //
+//                                                                           //
+// ========================================================================= //
+
+assign o_valid = valid_s[P_STAGES];
+assign o_ready = en;
+assign o_en = en;
+
+// ========================================================================= //
+//                                                                           //
+// UNUSED                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+if (P_STAGES == 0) begin : no_stages_GEN
+
+logic UNUSED__tie_off;
+assign UNUSED__tie_off = &{ clk, rst };
+
+end : no_stages_GEN
+
+endmodule : pipe_ctrl
@@ -0,0 +1,211 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+`include "common_defs.vh"
+
+module prefix_inc #(
+// ------------------------------------------------------------------------- //
+// Bit-Width
+  parameter int W
+// Carry architecture (see: prefix_pkg::arch_t)
+, parameter int P_ARCH = prefix_pkg::ARCH_INFERRED
+) (
+// ------------------------------------------------------------------------- //
+// Operand, and carry-in.
+  input wire logic [W - 1:0]                     i_x
+, input wire logic                               i_ci
+
+// ------------------------------------------------------------------------- //
+// Increment, and carry-out.
+, output wire logic [W - 1:0]                    o_y
+, output wire logic                              o_co
+);
+
+// Incrementer: {o_co, o_y} = i_x + i_ci, with an explicit carry network.
+//
+// As the addend has no bits other than the carry-in, each generate is
+// zero and each propagate is the operand bit, such that the carry into bit
+// 'i' is simply i_ci & (&i_x[i - 1:0]). The network therefore computes the
+// prefix-AND of i_x, as LEVELS levels of 2-input AND nodes in which each bit
+// is combined, at each level, with at most one lower bit (see: operand).
+//
+// In carry-select, the sum of each block is precomputed for both carry-ins
+// and selected by the carry into the block. For an increment, that for a
+// carry-in of zero is the operand itself, and the select reduces to an AND.
+
+localparam int L = (W > 1) ? $clog2(W) : 0;
+
+// Bits per carry-select block, ceil(sqrt(W)), and number of blocks.
+function automatic int csel_k();
+  int k = 1;
+  while ((k * k) < W)
+    k++;
+  return k;
+endfunction
+
+localparam int K = csel_k();
+localparam int NB = (W + K - 1) / K;
+
+// Last bit of carry-select block 'm'.
+function automatic int csel_last(int m);
+  return (((m + 1) * K) < W) ? ((m + 1) * K - 1) : (W - 1);
+endfunction
+
+function automatic int levels();
+  case (P_ARCH)
+    prefix_pkg::ARCH_RIPPLE:       return W - 1;
+    prefix_pkg::ARCH_BRENT_KUNG:   return (L > 0) ? (2 * L - 1) : 0;
+    prefix_pkg::ARCH_SKLANSKY,
+    prefix_pkg::ARCH_KOGGE_STONE:  return L;
+    prefix_pkg::ARCH_HAN_CARLSON:  return (L > 0) ? (L + 1) : 0;
+    prefix_pkg::ARCH_CARRY_SELECT:
+      return (K - 1) + (NB - 1) + ((NB > 1) ? 1 : 0);
+    default:                       return 0;
+  endcase
+endfunction
+
+localparam int LEVELS = levels();
+
+// Bit with which bit 'i' is combined at level 'd' (or -1, where it is
+// passed through).
+function automatic int operand(int d, int i);
+  int s;
+  int m;
+  case (P_ARCH)
+    prefix_pkg::ARCH_RIPPLE: begin
+      return (i == (d + 1)) ? (i - 1) : -1;
+    end
+    prefix_pkg::ARCH_BRENT_KUNG: begin
+      if (d < L) begin
+        // Up-sweep: bits 2s - 1, 4s - 1, ... combine with bit i - s.
+        s = 1 << d;
+        return (((i + 1) % (2 * s)) == 0) ? (i - s) : -1;
+      end
+      // Down-sweep: bits 3s - 1, 5s - 1, ... combine with bit i - s.
+      s = 1 << (2 * L - 2 - d);
+      return ((((i + 1) % (2 * s)) == s) && (i >= (2 * s))) ? (i - s) : -1;
+    end
+    prefix_pkg::ARCH_SKLANSKY: begin
+      // Upper half of each 2^(d + 1) block combines with the top of the
+      // lower half.
+      return (((i >> d) & 1) == 1) ? (((i >> d) << d) - 1) : -1;
+    end
+    prefix_pkg::ARCH_KOGGE_STONE: begin
+      s = 1 << d;
+      return (i >= s) ? (i - s) : -1;
+    end
+    prefix_pkg::ARCH_HAN_CARLSON: begin
+      if (d == 0)
+        return ((i % 2) == 1) ? (i - 1) : -1;
+      if (d < L) begin
+        s = 1 << d;
+        return (((i % 2) == 1) && (i >= s)) ? (i - s) : -1;
+      end
+      return (((i % 2) == 0) && (i >= 2)) ? (i - 1) : -1;
+    end
+    prefix_pkg::ARCH_CARRY_SELECT: begin
+      m = i / K;
+      // Ripple within each block (in parallel).
+      if (d < (K - 1))
+        return ((i % K) == (d + 1)) ? (i - 1) : -1;
+      // Ripple of block carries, into the last bit of block m.
+      if (d < ((K - 1) + (NB - 1)))
+        return ((m == (d - (K - 1) + 1)) && (i == csel_last(m))) ?
+          (m * K - 1) : -1;
+      // Select, of the remaining bits of each block by its carry-in.
+      return ((m >= 1) && (i != csel_last(m))) ? (m * K - 1) : -1;
+    end
+    default: begin
+      return -1;
+    end
+  endcase
+endfunction
+
+// ========================================================================= //
+//                                                                           //
+// Wire(s)                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+logic [W - 1:0]                        y;
+logic                                  co;
+
+// ========================================================================= //
+//                                                                           //
+// Logic.                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+if (P_ARCH == prefix_pkg::ARCH_INFERRED) begin : inferred_GEN
+
+assign {co, y} = {1'b0, i_x} + {{W{1'b0}}, i_ci};
+
+end : inferred_GEN
+else begin : network_GEN
+
+// Prefix-AND at each level; and_s[LEVELS][i] is &i_x[i:0].
+logic [LEVELS:0][W - 1:0]              and_s;
+// Carry into each bit.
+logic [W - 1:0]                        carry;
+
+assign and_s[0] = i_x;
+
+for (genvar d = 0; d < LEVELS; d++) begin : level_GEN
+for (genvar i = 0; i < W; i++) begin : bit_GEN
+
+localparam int J = operand(d, i);
+
+if (J >= 0) begin : node_GEN
+  assign and_s[d + 1][i] = and_s[d][i] & and_s[d][J];
+end : node_GEN
+else begin : pass_GEN
+  assign and_s[d + 1][i] = and_s[d][i];
+end : pass_GEN
+
+end : bit_GEN
+end : level_GEN
+
+assign carry[0] = i_ci;
+for (genvar i = 1; i < W; i++) begin : carry_GEN
+  assign carry[i] = i_ci & and_s[LEVELS][i - 1];
+end : carry_GEN
+
+assign y = i_x ^ carry;
+assign co = i_ci & and_s[LEVELS][W - 1];
+
+end : network_GEN
+
+// ========================================================================= //
+//                                                                           //
+// Output(s)                                                                 //
+//                                                                           //
+// ========================================================================= //
+
+assign o_y = y;
+assign o_co = co;
+
+endmodule : prefix_inc
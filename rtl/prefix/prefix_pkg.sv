@@ -0,0 +1,50 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+// Carry architectures of prefix_inc (see: prefix_inc.sv).
+
+package prefix_pkg;
+
+typedef enum int {
+  // Behavioral ('+'); architecture left to synthesis.
+  ARCH_INFERRED,
+  // Serial; W - 1 levels.
+  ARCH_RIPPLE,
+  // Up- and down-sweep trees; 2 * log2(W) - 1 levels, ~2W nodes.
+  ARCH_BRENT_KUNG,
+  // Divide-and-conquer; log2(W) levels, fanout up to W / 2.
+  ARCH_SKLANSKY,
+  // log2(W) levels, fanout 2, ~W log2(W) nodes.
+  ARCH_KOGGE_STONE,
+  // Kogge-Stone on odd bits, then one level for even bits; log2(W) + 1
+  // levels, ~(W / 2) log2(W) nodes.
+  ARCH_HAN_CARLSON,
+  // Ripple within blocks of ~sqrt(W) bits, and across their carries.
+  ARCH_CARRY_SELECT
+} arch_t;
+
+endpackage : prefix_pkg
@@ -26,7 +26,8 @@
 ##========================================================================== //
 
 set(COMMON_RTL_SOURCES
-    ${CMAKE_SOURCE_DIR}/rtl/common_defs.vh)
+    ${CMAKE_SOURCE_DIR}/rtl/common_defs.vh
+    ${CMAKE_SOURCE_DIR}/rtl/pipe/pipe_ctrl.sv)
 
 set(E_RTL_SOURCES
     ${COMMON_RTL_SOURCES}
@@ -38,8 +39,14 @@ set(U_RTL_SOURCES
     ${CMAKE_SOURCE_DIR}/rtl/u/u_mask.sv
     ${CMAKE_SOURCE_DIR}/rtl/u/u.sv)
 
+# Incrementer with selectable carry architecture (of P and O).
+set(PREFIX_RTL_SOURCES
+    ${CMAKE_SOURCE_DIR}/rtl/prefix/prefix_pkg.sv
+    ${CMAKE_SOURCE_DIR}/rtl/prefix/prefix_inc.sv)
+
 set(P_RTL_SOURCES
     ${COMMON_RTL_SOURCES}
+    ${PREFIX_RTL_SOURCES}
     ${CMAKE_SOURCE_DIR}/rtl/p/p_is_1hot.sv
     ${CMAKE_SOURCE_DIR}/rtl/p/p.sv)
 
@@ -51,4 +58,22 @@ set(C_RTL_SOURCES
 
 set(O_RTL_SOURCES
     ${COMMON_RTL_SOURCES}
-    ${CMAKE_SOURCE_DIR}/rtl/o/o.sv)
\ No newline at end of file
+    ${PREFIX_RTL_SOURCES}
+    ${CMAKE_SOURCE_DIR}/rtl/o/o.sv)
+
+# Selects among the above (see: syn/selection.py).
+set(UNARY_DETECT_RTL_SOURCES
+    ${COMMON_RTL_SOURCES}
+    ${PREFIX_RTL_SOURCES}
+    ${CMAKE_SOURCE_DIR}/rtl/e/e_is_1hot.sv
+    ${CMAKE_SOURCE_DIR}/rtl/e/e.sv
+    ${CMAKE_SOURCE_DIR}/rtl/u/u_mask.sv
+    ${CMAKE_SOURCE_DIR}/rtl/u/u.sv
+    ${CMAKE_SOURCE_DIR}/rtl/p/p_is_1hot.sv
+    ${CMAKE_SOURCE_DIR}/rtl/p/p.sv
+    ${CMAKE_SOURCE_DIR}/rtl/c/c_v_cell.sv
+    ${CMAKE_SOURCE_DIR}/rtl/c/c_v.sv
+    ${CMAKE_SOURCE_DIR}/rtl/c/c.sv
+    ${CMAKE_SOURCE_DIR}/rtl/o/o.sv
+    ${CMAKE_SOURCE_DIR}/rtl/unary_detect/unary_detect_pkg.sv
+    ${CMAKE_SOURCE_DIR}/rtl/unary_detect/unary_detect.sv)
@@ -33,15 +33,28 @@ module u #(
   parameter int W
 // Enable admission of complimented unary code
 , parameter bit P_ADMIT_COMPLIMENT_EN
+// Pipeline stages (0: combinational)
+, parameter int P_PIPE_STAGES = 0
 ) (
 // ------------------------------------------------------------------------- //
 // Input vector
   input wire logic [W - 1:0]                     i_x
+// Input vector valid, and accepted.
+, input wire logic                               i_valid
+, output wire logic                              o_ready
 
 // Admission Decision
 , output wire logic                              o_is_unary
 // Compliment form unary.
 , output wire logic                              o_is_compliment
+// Admission Decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset (of pipeline stages)
+, input wire logic                               clk
+, input wire logic                               rst
 );
 
 // Circuit to admit an arbitrary lengthed unary-/thermometer-coded bit-vector.
@@ -63,6 +76,24 @@ module u #(
 //
 //  Circuit does not admit the all-one or all-zero bitvector (respectively)
 //  as this is not considered to be a valid unary encoding. 
+//
+// Pipelining: the first stage register follows the matches at each pivot;
+// the matches are then reduced by a tree of 2^(P_PIPE_STAGES - 1) leaves,
+// a stage register following the leaves and each level of the tree but the
+// last (the root). Latency is P_PIPE_STAGES cycles (see: pipe_ctrl).
+
+// Stages of the reduction tree (beyond the first).
+localparam int TREE_STAGES = (P_PIPE_STAGES > 0) ? (P_PIPE_STAGES - 1) : 0;
+
+localparam int LEAVES = (1 << TREE_STAGES);
+
+// Pivots of the widest leaf.
+localparam int LEAF_W = (W + LEAVES - 1) / LEAVES;
+
+// Pivots of leaf 'k': [leaf_lo(k), leaf_lo(k + 1)).
+function automatic int leaf_lo(int k);
+  return (k * W) / LEAVES;
+endfunction
 
 // ========================================================================= //
 //                                                                           //
@@ -80,12 +111,34 @@ logic [W - 1:0]              is_unary_v;
 logic                        is_unary;
 logic                        is_compliment;
 
+logic                        en;
+
+// Matches, as reduced by the tree.
+logic [W - 1:0]              is_unary_v_s;
+
+// Nodes at each level of the tree (level 0: the leaves; level TREE_STAGES:
+// the root), of which level 'l' has LEAVES >> l.
+logic [TREE_STAGES:0][LEAVES - 1:0] is_unary_d;
+
+// Input vector MSB, into each level.
+logic [TREE_STAGES:0]        msb_s;
+
 // ========================================================================= //
 //                                                                           //
 // Logic.                                                                    //
 //                                                                           //
 // ========================================================================= //
 
+pipe_ctrl #(.P_STAGES(P_PIPE_STAGES)) u_pipe_ctrl (
+  .i_valid              (i_valid)
+, .o_ready              (o_ready)
+, .o_valid              (o_valid)
+, .i_ready              (i_ready)
+, .o_en                 (en)
+, .clk                  (clk)
+, .rst                  (rst)
+);
+
 for (genvar i = 0; i < W; i++) begin : is_unary_i_GEN
 
 // Match: xxxxxx[1]11111, where [] is pivot 'i'
@@ -136,12 +189,84 @@ assign match_n_v[W - 1] = P_ADMIT_COMPLIMENT_EN ? (i_x == '1) : 1'b0;
 // Match vector on unary code or its compliment. 
 assign is_unary_v = (match_v | match_n_v);
 
+if (P_PIPE_STAGES == 0) begin : no_stages_GEN
+
+assign is_unary_v_s = is_unary_v;
+assign msb_s[0] = i_x[W - 1];
+
+end : no_stages_GEN
+else begin : match_stage_GEN
+
+logic [W - 1:0]              is_unary_v_r;
+logic                        msb_r;
+
+always_ff @(posedge clk) begin : stage_reg_PROC
+  if (en) begin
+    is_unary_v_r <= is_unary_v;
+    msb_r <= i_x[W - 1];
+  end
+end : stage_reg_PROC
+
+assign is_unary_v_s = is_unary_v_r;
+assign msb_s[0] = msb_r;
+
+end : match_stage_GEN
+
 // Admit is unary-/thermometer- code if valid encoding is found at any
 // pivot index in the input bit-vector. 
-assign is_unary = (is_unary_v != 0);
+for (genvar k = 0; k < LEAVES; k++) begin : leaf_GEN
+
+logic [LEAF_W - 1:0]         leaf_v;
+
+for (genvar i = 0; i < LEAF_W; i++) begin : bit_GEN
+
+if ((leaf_lo(k) + i) < leaf_lo(k + 1)) begin : in_GEN
+  assign leaf_v[i] = is_unary_v_s[leaf_lo(k) + i];
+end : in_GEN
+else begin : pad_GEN
+  assign leaf_v[i] = 1'b0;
+end : pad_GEN
+
+end : bit_GEN
+
+assign is_unary_d[0][k] = (leaf_v != 0);
+
+end : leaf_GEN
+
+for (genvar l = 1; l <= TREE_STAGES; l++) begin : level_GEN
+
+// Nodes of the level below.
+localparam int NODES = (LEAVES >> (l - 1));
+
+logic [NODES - 1:0]          is_unary_r;
+logic                        msb_r;
+
+always_ff @(posedge clk) begin : stage_reg_PROC
+  if (en) begin
+    is_unary_r <= is_unary_d[l - 1][NODES - 1:0];
+    msb_r <= msb_s[l - 1];
+  end
+end : stage_reg_PROC
+
+assign msb_s[l] = msb_r;
+
+for (genvar k = 0; k < LEAVES; k++) begin : node_GEN
+
+if (k < (LEAVES >> l)) begin : in_GEN
+  assign is_unary_d[l][k] = is_unary_r[2 * k] | is_unary_r[2 * k + 1];
+end : in_GEN
+else begin : none_GEN
+  assign is_unary_d[l][k] = 1'b0;
+end : none_GEN
+
+end : node_GEN
+
+end : level_GEN
+
+assign is_unary = is_unary_d[TREE_STAGES][0];
 
 // is_compliment whenever configured to detect such encodings and MSB is set.
-assign is_compliment = (P_ADMIT_COMPLIMENT_EN & i_x[W - 1]);
+assign is_compliment = (P_ADMIT_COMPLIMENT_EN & msb_s[TREE_STAGES]);
 
 // ========================================================================= //
 //                                                                           //
@@ -162,6 +287,8 @@ logic UNUSED__tie_off;
 assign UNUSED__tie_off = &{ match_lo_v[W - 1],
                             match_hi_v[0],
                             match_lo_n_v[W - 1],
-                            match_hi_n_v[0] };
+                            match_hi_n_v[0],
+                            en,
+                            is_unary_d };
 
 endmodule : u
@@ -0,0 +1,129 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+`include "common_defs.vh"
+
+module unary_detect #(
+// ------------------------------------------------------------------------- //
+// Bit-Width
+  parameter int W
+// Enable admission of complimented unary code
+, parameter bit P_ADMIT_COMPLIMENT_EN
+// Target clock frequency (MHz); 0 selects the smallest implementation.
+, parameter int TARGET_MHZ = 0
+// Pipeline stages (0: combinational) of the implementation.
+, parameter int P_PIPE_STAGES = 0
+// Carry architecture of the incrementer-based implementations (p, o).
+, parameter int P_ADDER_ARCH = prefix_pkg::ARCH_INFERRED
+// One-hot detection by reduction tree, of the implementations e and p.
+, parameter bit P_1HOT_TREE_EN = 1'b0
+) (
+// ------------------------------------------------------------------------- //
+// Input vector
+  input wire logic [W - 1:0]                     i_x
+// Input vector valid, and accepted.
+, input wire logic                               i_valid
+, output wire logic                              o_ready
+
+// Admission Decision
+, output wire logic                              o_is_unary
+// Compliment form unary.
+, output wire logic                              o_is_compliment
+// Admission Decision valid, and accepted.
+, output wire logic                              o_valid
+, input wire logic                               i_ready
+
+// ------------------------------------------------------------------------- //
+// Clk/Reset (of pipeline stages)
+, input wire logic                               clk
+, input wire logic                               rst
+);
+
+// Unary detector that instantiates, at elaboration, the smallest of the
+// implementations (u, e, p, c or o) that meets TARGET_MHZ at width W; if
+// none does, the fastest. The selection is made from measured PPA (see:
+// unary_detect_pkg, as generated by the synthesis flow). Latency is that of
+// the implementation: P_PIPE_STAGES cycles.
+
+import unary_detect_pkg::*;
+
+localparam impl_t IMPL = select_impl(W, TARGET_MHZ);
+
+// ========================================================================= //
+//                                                                           //
+// Logic.                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+if (IMPL == IMPL_U) begin : u_GEN
+
+u #(.W(W), .P_ADMIT_COMPLIMENT_EN(P_ADMIT_COMPLIMENT_EN),
+    .P_PIPE_STAGES(P_PIPE_STAGES)) u_impl (
+  .i_x(i_x), .i_valid(i_valid), .o_ready(o_ready),
+  .o_is_unary(o_is_unary), .o_is_compliment(o_is_compliment),
+  .o_valid(o_valid), .i_ready(i_ready), .clk(clk), .rst(rst));
+
+end : u_GEN
+else if (IMPL == IMPL_E) begin : e_GEN
+
+e #(.W(W), .P_ADMIT_COMPLIMENT_EN(P_ADMIT_COMPLIMENT_EN),
+    .P_PIPE_STAGES(P_PIPE_STAGES), .P_1HOT_TREE_EN(P_1HOT_TREE_EN)) u_impl (
+  .i_x(i_x), .i_valid(i_valid), .o_ready(o_ready),
+  .o_is_unary(o_is_unary), .o_is_compliment(o_is_compliment),
+  .o_valid(o_valid), .i_ready(i_ready), .clk(clk), .rst(rst));
+
+end : e_GEN
+else if (IMPL == IMPL_P) begin : p_GEN
+
+p #(.W(W), .P_ADMIT_COMPLIMENT_EN(P_ADMIT_COMPLIMENT_EN),
+    .P_PIPE_STAGES(P_PIPE_STAGES), .P_ADDER_ARCH(P_ADDER_ARCH),
+    .P_1HOT_TREE_EN(P_1HOT_TREE_EN)) u_impl (
+  .i_x(i_x), .i_valid(i_valid), .o_ready(o_ready),
+  .o_is_unary(o_is_unary), .o_is_compliment(o_is_compliment),
+  .o_valid(o_valid), .i_ready(i_ready), .clk(clk), .rst(rst));
+
+end : p_GEN
+else if (IMPL == IMPL_C) begin : c_GEN
+
+c #(.W(W), .P_ADMIT_COMPLIMENT_EN(P_ADMIT_COMPLIMENT_EN),
+    .P_PIPE_STAGES(P_PIPE_STAGES)) u_impl (
+  .i_x(i_x), .i_valid(i_valid), .o_ready(o_ready),
+  .o_is_unary(o_is_unary), .o_is_compliment(o_is_compliment),
+  .o_valid(o_valid), .i_ready(i_ready), .clk(clk), .rst(rst));
+
+end : c_GEN
+else begin : o_GEN
+
+o #(.W(W), .P_ADMIT_COMPLIMENT_EN(P_ADMIT_COMPLIMENT_EN),
+    .P_PIPE_STAGES(P_PIPE_STAGES), .P_ADDER_ARCH(P_ADDER_ARCH)) u_impl (
+  .i_x(i_x), .i_valid(i_valid), .o_ready(o_ready),
+  .o_is_unary(o_is_unary), .o_is_compliment(o_is_compliment),
+  .o_valid(o_valid), .i_ready(i_ready), .clk(clk), .rst(rst));
+
+end : o_GEN
+
+endmodule : unary_detect
@@ -0,0 +1,77 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+// Generated by syn/selection.py; do not edit.
+// Source: syn/syn_results.md (sky130_fd_sc_hd, area-driven); 'o' is omitted,
+// its figures predating the fix to its admission of compliments
+
+package unary_detect_pkg;
+
+typedef enum int {
+  IMPL_U, IMPL_E, IMPL_P, IMPL_C, IMPL_O
+} impl_t;
+
+// Smallest implementation (post-synthesis combinatorial cell area)
+// whose f_max meets 'target_mhz' at width 'w'; otherwise, the
+// fastest. Widths between those measured take the measurements of
+// the next wider, and those beyond, of the widest.
+function automatic impl_t select_impl(int w, int target_mhz);
+  if (w <= 4) begin
+    // c: 31.28 um^2, 400 MHz
+    return IMPL_C;
+  end
+  else if (w <= 8) begin
+    // c: 83.83 um^2, 400 MHz
+    return IMPL_C;
+  end
+  else if (w <= 16) begin
+    // p: 250.24 um^2, 280 MHz
+    if (target_mhz <= 280) return IMPL_P;
+    // u: 280.27 um^2, 380 MHz
+    return IMPL_U;
+  end
+  else if (w <= 32) begin
+    // c: 571.80 um^2, 100 MHz
+    if (target_mhz <= 100) return IMPL_C;
+    // u: 761.98 um^2, 200 MHz
+    if (target_mhz <= 200) return IMPL_U;
+    // e: 802.02 um^2, 280 MHz
+    return IMPL_E;
+  end
+  else if (w <= 64) begin
+    // c: 1206.16 um^2, 40 MHz
+    if (target_mhz <= 40) return IMPL_C;
+    // e: 1620.30 um^2, 240 MHz
+    return IMPL_E;
+  end
+  else begin
+    // e: 3219.34 um^2, 180 MHz
+    return IMPL_E;
+  end
+endfunction
+
+endpackage : unary_detect_pkg
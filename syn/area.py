@@ -0,0 +1,141 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import collections
+import functools
+import re
+
+@functools.lru_cache(maxsize=None)
+def liberty_areas(liberty: str) -> dict:
+    # Area of each cell of a liberty, by name.
+    areas = {}
+    cell = None
+    with open(liberty) as f:
+        for line in f:
+            if m := re.match(r'\s*cell\s*\(\s*"?([\w$]+)"?\s*\)', line):
+                cell = m.group(1)
+            elif cell and (m := re.match(r'\s*area\s*:\s*([\d\.]+)', line)):
+                areas[cell] = float(m.group(1))
+                cell = None
+    return areas
+
+def module_name(name: str) -> str:
+    # Module of a (possibly parameterized) Yosys module name; for example,
+    # '$paramod\e_is_1hot\W=32' is 'e_is_1hot'.
+    name = name.lstrip('\\')
+    if name.startswith('$paramod'):
+        name = name.split('\\')[1]
+    return name
+
+def block_name(instance: str) -> str:
+    # Generate scope of an instance, without indices; for example,
+    # 'edge_GEN[3].u_cell' is 'edge_GEN'. None if not within a scope.
+    scopes = instance.lstrip('\\').split('.')[:-1]
+    if not scopes:
+        return None
+    return '.'.join(re.sub(r'\[\d+\]', '', s) for s in scopes)
+
+class Attribution:
+    # Cell area of a hierarchical (unflattened) netlist, attributed by
+    # module, by generate block, and by cell type. Areas are summed over
+    # all instances of a module (or block).
+    def __init__(self, modules: dict = None, blocks: dict = None,
+                 cell_types: dict = None):
+        # Own (non-hierarchical) cell area, by module.
+        self.modules = modules or {}
+        # Area of submodule instances (inclusive), by '<module>/<block>'.
+        self.blocks = blocks or {}
+        # (count, area), by cell type.
+        self.cell_types = cell_types or {}
+
+    @staticmethod
+    def parse(netlist: str, liberty: str, top: str = 'top') -> 'Attribution':
+        # Netlist as written by 'write_verilog -noattr -noexpr', without
+        # flattening.
+        areas = liberty_areas(str(liberty))
+        cells = {}
+        instances = {}
+        module = None
+        with open(netlist) as f:
+            for line in f:
+                if m := re.match(r'module\s+(\S+)\s*\(', line):
+                    module = m.group(1).lstrip('\\')
+                    cells[module] = collections.Counter()
+                    instances[module] = []
+                elif line.startswith('endmodule'):
+                    module = None
+                elif module and (m := re.match(
+                        r'\s+(\\\S+|[\w$]+)\s+(\\\S+|[\w$]+)\s*\(', line)):
+                    kind, name = m.group(1).lstrip('\\'), m.group(2)
+                    if kind in areas:
+                        cells[module][kind] += 1
+                    else:
+                        instances[module].append((name, kind))
+
+        a = Attribution()
+
+        @functools.lru_cache(maxsize=None)
+        def inclusive(m: str) -> float:
+            return sum(n * areas[k] for k, n in cells[m].items()) + \
+                sum(inclusive(s) for _, s in instances[m] if s in cells)
+
+        def visit(m: str):
+            name = module_name(m)
+            own = 0.0
+            for k, n in cells[m].items():
+                count, area = a.cell_types.get(k, (0, 0.0))
+                a.cell_types[k] = (count + n, area + n * areas[k])
+                own += n * areas[k]
+            a.modules[name] = a.modules.get(name, 0.0) + own
+            for instance, s in instances[m]:
+                if s not in cells:
+                    continue
+                if block := block_name(instance):
+                    b = f'{name}/{block}'
+                    a.blocks[b] = a.blocks.get(b, 0.0) + inclusive(s)
+                visit(s)
+
+        if top in cells:
+            visit(top)
+        return a
+
+    def total(self) -> float:
+        return sum(self.modules.values())
+
+    def to_dict(self) -> dict:
+        return {
+            'modules': self.modules,
+            'blocks': self.blocks,
+            'cell_types': self.cell_types,
+        }
+
+    @staticmethod
+    def from_dict(d: dict) -> 'Attribution':
+        return Attribution(
+            modules=d['modules'],
+            blocks=d['blocks'],
+            cell_types={k: tuple(v) for k, v in d['cell_types'].items()})
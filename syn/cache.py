@@ -0,0 +1,127 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import functools
+import hashlib
+import json
+import os
+import pathlib
+import shutil
+import tempfile
+
+def _digest_update(h, part):
+    # Length-prefixed, such that concatenations of parts are unambiguous.
+    if isinstance(part, pathlib.Path):
+        part = part.read_bytes()
+    elif not isinstance(part, bytes):
+        part = str(part).encode()
+    h.update(len(part).to_bytes(8, 'little'))
+    h.update(part)
+
+def digest(*parts) -> str:
+    h = hashlib.sha256()
+    for part in parts:
+        _digest_update(h, part)
+    return h.hexdigest()
+
+@functools.lru_cache(maxsize=None)
+def _file_digest(path: str, mtime_ns: int, size: int) -> str:
+    h = hashlib.sha256()
+    with open(path, 'rb') as f:
+        while chunk := f.read(1 << 20):
+            h.update(chunk)
+    return h.hexdigest()
+
+def file_digest(path) -> str:
+    # Digest of file contents; memoized on (path, mtime, size) as liberty
+    # files are large and consulted by every job.
+    st = os.stat(path)
+    return _file_digest(str(path), st.st_mtime_ns, st.st_size)
+
+def normalise_paths(text: str, tokens: dict) -> str:
+    # 'text' with each path (of 'tokens') replaced by its token, such that
+    # its digest does not depend on where the sources, build directory or
+    # tools reside. Longer paths are replaced first, as they may extend
+    # shorter ones.
+    for path in sorted(tokens, key=len, reverse=True):
+        text = text.replace(path, tokens[path])
+    return text
+
+@functools.lru_cache(maxsize=None)
+def tool_version(executable: str, flag: str) -> str:
+    from subprocess import run, PIPE, DEVNULL, SubprocessError
+
+    try:
+        p = run([executable, flag], stdout=PIPE, stderr=DEVNULL, timeout=60)
+        if p.returncode == 0 and p.stdout.strip():
+            return p.stdout.decode().strip()
+    except (OSError, SubprocessError):
+        pass
+    # Otherwise, identify the tool by its installed binary.
+    st = os.stat(executable)
+    return f'{executable}:{st.st_mtime_ns}:{st.st_size}'
+
+class ResultCache:
+    # Content-addressed store of tool outcomes. Each entry is a directory,
+    # named by its key, holding output files and a JSON result.
+    def __init__(self, **kwargs):
+        self._root = pathlib.Path(kwargs.get('root'))
+        self._root.mkdir(parents=True, exist_ok=True)
+
+    def _entry(self, key: str) -> pathlib.Path:
+        return self._root / key[:2] / key
+
+    def load(self, key: str, path: pathlib.Path = None):
+        # Returns the result of a hit (restoring output files into 'path'),
+        # otherwise None.
+        entry = self._entry(key)
+        try:
+            result = json.loads((entry / 'result.json').read_text())
+        except (OSError, ValueError):
+            return None
+        for fn in result.get('files', []):
+            shutil.copyfile(entry / fn, path / fn)
+        return result
+
+    def store(self, key: str, result: dict, path: pathlib.Path = None,
+              files: tuple = ()):
+        entry = self._entry(key)
+        if entry.exists():
+            return
+        entry.parent.mkdir(parents=True, exist_ok=True)
+
+        # Populate aside and rename into place, such that concurrent (or
+        # interrupted) writers never expose a partial entry.
+        tmp = pathlib.Path(tempfile.mkdtemp(dir=entry.parent))
+        try:
+            for fn in files:
+                shutil.copyfile(path / fn, tmp / fn)
+            (tmp / 'result.json').write_text(
+                json.dumps(dict(result, files=list(files))))
+            os.rename(tmp, entry)
+        except OSError:
+            shutil.rmtree(tmp, ignore_errors=True)
@@ -0,0 +1,242 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import itertools
+import pathlib
+
+from cache import ResultCache
+from scheduler import Scheduler
+from session import opensta_session_pool, synlig_session_pool
+from syn import (EstimateRunner, InstanceRunner, instance_name,
+                 synthesis_memory_mb)
+
+# Design-space exploration: each point of a design's parameter space is
+# first estimated by a fast pre-map; points whose estimate is dominated
+# (by a margin) are pruned, and of the remainder, those most promising are
+# fully synthesized and analyzed, within a budget. The Pareto frontier of
+# area, f_max and (where estimated) energy is then reported per W.
+
+# Parameters of the space that are synthesis options, rather than RTL
+# parameters.
+SYNTHESIS_PARAMS = ('delay_target_frequency',)
+
+def dominates(a: tuple, b: tuple, margin: float = 1.0) -> bool:
+    # 'a' dominates 'b' (all objectives minimized, and non-negative), where
+    # 'b' is no better in any objective, and worse by a factor of at least
+    # 'margin' in all (if 'margin' > 1) or in one (otherwise).
+    if margin > 1.0:
+        return all(x * margin <= y for x, y in zip(a, b))
+    return all(x <= y for x, y in zip(a, b)) and a != b
+
+def pareto_ranks(items: list, objectives) -> dict:
+    # Non-dominated sorting: rank 0 is the Pareto frontier, rank 1 that of
+    # the remainder, and so on; by index into 'items'.
+    remaining = {i: objectives(x) for i, x in enumerate(items)}
+    ranks = {}
+    rank = 0
+    while remaining:
+        front = [i for i, a in remaining.items()
+                 if not any(dominates(b, a) for b in remaining.values())]
+        for i in front:
+            ranks[i] = rank
+            del remaining[i]
+        rank += 1
+    return ranks
+
+class Point:
+    # A point of a design's parameter space, at a W.
+    def __init__(self, project: str, w: int, params: dict,
+                 delay_target_frequency: int = None, variant: int = 0):
+        self.project = project
+        self.w = w
+        self.params = params
+        self.delay_target_frequency = delay_target_frequency
+        # Index of its synthesis options (of the design's space).
+        self.variant = variant
+        # Estimate (generic cells, depth) of its configuration.
+        self.estimate = (None, None)
+        # 'pruned', 'over budget', or 'evaluated'.
+        self.state = None
+        self.result = None
+        self.pareto = False
+
+    def objectives(self) -> tuple:
+        # Area, f_max and energy (if estimated), all minimized.
+        r = self.result
+        energy = r.energy()
+        return (r.combinatorial_area(), -r.f_max(),
+                0.0 if energy is None else energy)
+
+    def evaluated(self) -> bool:
+        return (self.result is not None) and (self.result.f_max() is not None)
+
+    def describe(self) -> str:
+        params = ', '.join(f'{k}={v}' for k, v in self.params.items())
+        return params or '-'
+
+    def mode(self) -> str:
+        if self.delay_target_frequency:
+            return f'delay@{self.delay_target_frequency}MHz'
+        return 'area'
+
+def combinations(space: dict) -> list:
+    # All combinations of parameter values, as dicts.
+    names = list(space.keys())
+    return [dict(zip(names, values))
+            for values in itertools.product(*space.values())]
+
+def split_space(space: dict) -> tuple:
+    # (RTL parameters, synthesis parameters) of a space.
+    rtl = {k: v for k, v in space.items() if k not in SYNTHESIS_PARAMS}
+    synthesis = {k: v for k, v in space.items() if k in SYNTHESIS_PARAMS}
+    return (rtl, synthesis)
+
+def run_design_space_exploration(**kwargs) -> dict:
+    from cfg import STDCELL_LIBS
+
+    library = kwargs.get('library') or next(iter(STDCELL_LIBS))
+    lib = STDCELL_LIBS[library]
+    cache = None
+    if cache_root := kwargs.get('cache_root'):
+        cache = ResultCache(root=cache_root)
+    # Full evaluations (synthesis and timing analysis) permitted, over all W.
+    budget = kwargs.get('budget', 32)
+    # Estimates dominated by at least this factor are pruned.
+    prune_margin = kwargs.get('prune_margin', 1.25)
+
+    sessions = {}
+    if kwargs.get('sessions', False):
+        sessions = {
+            'synlig': synlig_session_pool(),
+            'opensta': opensta_session_pool(lib['corners']),
+        }
+
+    common = {
+        'include_paths': kwargs.get('include_paths', []),
+        'top_level_template': kwargs.get('top_level_template'),
+        'echo': kwargs.get('echo', False),
+        'cache': cache,
+        'liberty': lib['synthesis'],
+    }
+
+    try:
+        # Estimate each configuration (a design's RTL parameters, at a W).
+        sched = Scheduler(jobs=kwargs.get('jobs'),
+                          memory_mb=kwargs.get('memory_mb'))
+        estimates = []
+        points = {}
+        for w in kwargs.get('w_sweep', []):
+            for project, space in kwargs.get('spaces', {}).items():
+                rtl_space, synthesis_space = split_space(space)
+                for rtl in combinations(rtl_space):
+                    path = pathlib.Path(instance_name(project, w, params=rtl))
+                    (path / 'est').mkdir(parents=True, exist_ok=True)
+                    er = EstimateRunner(
+                        **common, project=project, w=w, params=rtl,
+                        path=path / 'est',
+                        sources=kwargs['projects'][project],
+                        sessions=sessions.get('synlig'))
+                    sched.add(name=f'{path}/est', fn=er.run,
+                              memory_mb=synthesis_memory_mb(w) // 2)
+                    # Each configuration, with each synthesis option.
+                    ps = [Point(project, w, rtl, variant=i, **synthesis)
+                          for i, synthesis in
+                          enumerate(combinations(synthesis_space))]
+                    points.setdefault(w, []).extend(ps)
+                    estimates.append((er, ps))
+        sched.run()
+        for er, ps in estimates:
+            for p in ps:
+                p.estimate = er.estimate()
+
+        # Prune points whose estimate failed, or is dominated by that of
+        # another by the margin. The remainder are ordered by their
+        # estimated frontier, then such that each configuration is
+        # evaluated with its first synthesis options before any other.
+        queues = {}
+        for w, ps in points.items():
+            estimated = [p for p in ps if p.estimate[0] is not None]
+            for p in ps:
+                if (p.estimate[0] is None) or any(
+                        dominates(q.estimate, p.estimate, prune_margin)
+                        for q in estimated):
+                    p.state = 'pruned'
+            candidates = [p for p in ps if p.state is None]
+            ranks = pareto_ranks(candidates, lambda p: p.estimate)
+            order = sorted(
+                range(len(candidates)),
+                key=lambda i: (ranks[i], candidates[i].variant,
+                               candidates[i].estimate[0] *
+                               candidates[i].estimate[1]))
+            queues[w] = [candidates[i] for i in order]
+
+        # Spend the budget across W in turn, most promising first.
+        selected = []
+        while len(selected) < budget and any(queues.values()):
+            for q in queues.values():
+                if q and len(selected) < budget:
+                    selected.append(q.pop(0))
+        for q in queues.values():
+            for p in q:
+                p.state = 'over budget'
+
+        sched = Scheduler(jobs=kwargs.get('jobs'),
+                          memory_mb=kwargs.get('memory_mb'))
+        runners = []
+        for p in selected:
+            p.state = 'evaluated'
+            ir = InstanceRunner(
+                **common,
+                project=p.project,
+                w=p.w,
+                params=p.params,
+                delay_target_frequency=p.delay_target_frequency,
+                reference_frequency=kwargs.get('reference_frequency', 1000),
+                corners=lib['corners'],
+                activity=kwargs.get('activity'),
+                power_corner=lib.get('power_corner'),
+                sources=kwargs['projects'][p.project],
+                sessions=sessions)
+            ir.submit(sched)
+            runners.append((p, ir))
+        sched.run()
+    finally:
+        for pool in sessions.values():
+            pool.close()
+
+    for p, ir in runners:
+        p.result = ir.results()
+
+    # Pareto frontier of the evaluated points, per W.
+    for w, ps in points.items():
+        evaluated = [p for p in ps if p.evaluated()]
+        ranks = pareto_ranks(evaluated, Point.objectives)
+        for i, p in enumerate(evaluated):
+            p.pareto = (ranks[i] == 0)
+
+    # Points (including those pruned, or over budget), by W.
+    return points
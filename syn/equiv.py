@@ -0,0 +1,185 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import os
+import pathlib
+import re
+
+class EquivalenceRunner:
+    def __init__(self, **kwargs):
+        self._path = kwargs.get('path')
+        self._design = kwargs.get('design')
+        self._reference = kwargs.get('reference')
+        self._w = kwargs.get('w')
+        self._admit_compliment = kwargs.get('admit_compliment', True)
+        # Design parameters (in addition to W, P_ADMIT_COMPLIMENT_EN).
+        self._params = kwargs.get('params', {})
+        self._sources = kwargs.get('sources', [])
+        self._include_paths = kwargs.get('include_paths', [])
+        self._miter_template = kwargs.get('miter_template')
+        self._miter_sv = kwargs.get('miter_sv', 'miter.sv')
+        self._script_tcl = kwargs.get('script_tcl', 'equiv.tcl')
+        self._cex = kwargs.get('cex', 'cex.txt')
+        self._echo = kwargs.get('echo', False)
+        self._passed = None
+        self._counterexample = None
+
+    def run(self):
+        self._path.mkdir(parents=True, exist_ok=True)
+        self._render_miter()
+        self._render_synlig_script()
+        ec, stdout = self._run_synlig()
+        if self._echo:
+            print(stdout)
+        self._passed, self._counterexample = self._scan_synlig_output(stdout)
+        if self._counterexample is not None:
+            self._write_counterexample()
+
+    def name(self) -> str:
+        return self._path.name
+
+    def passed(self) -> bool:
+        return bool(self._passed)
+
+    def counterexample(self):
+        # Path of counterexample file (if any).
+        if self._counterexample is None:
+            return None
+        return self._path / self._cex
+
+    def _render_miter(self):
+        import jinja2
+
+        t = jinja2.Template(pathlib.Path(self._miter_template).read_text())
+
+        env = {
+            'W': self._w,
+            'ADMIT_COMPLIMENT_EN': '1\'b1' if self._admit_compliment else '1\'b0',
+            'design': self._design,
+            'PARAMS': ''.join(f', .{k}({v})' for k, v in self._params.items()),
+            'reference': self._reference,
+            # The behavioral specification has no valid/ready interface.
+            'reference_handshake': self._reference != 'spec',
+        }
+        (self._path / self._miter_sv).write_text(t.render(env))
+
+    def _render_synlig_script(self):
+        with open(self._path / self._script_tcl, 'w') as f:
+            f.write(f'# Synlig script\n')
+            f.write(f'# Miter: {self._design} vs. {self._reference}\n')
+
+            include_files = [
+                f'-I{include_path}' for include_path in self._include_paths]
+
+            cmds = []
+            sources = list(dict.fromkeys(self._sources))
+            sources.append(str((self._path / self._miter_sv).resolve()))
+            for src in sources:
+                cmds.append(f'read_systemverilog {" ".join(include_files)} -defer {src}')
+
+            cmds += [
+                'read_systemverilog -link',
+                'hierarchy -check -top miter',
+                'proc',
+                'flatten',
+                'opt',
+                'sat -prove o_trigger 0 -show-inputs',
+            ]
+            f.write('\n'.join(cmds) + '\n')
+
+    def _run_synlig(self):
+        from cfg import SYNLIG_EXECUTABLE
+
+        from subprocess import Popen, PIPE
+        p = Popen([SYNLIG_EXECUTABLE, '-s', self._script_tcl],
+            stdout=PIPE, stderr=PIPE, cwd=self._path)
+        output, err = p.communicate()
+        return (p.returncode, output.decode())
+
+    def _scan_synlig_output(self, stdout: str):
+        passed = None
+        counterexample = None
+
+        for line in stdout.splitlines():
+            if re.search(r'SAT proof finished - no model found: SUCCESS', line):
+                passed = True
+            elif re.search(r'SAT proof finished - model found: FAIL', line):
+                passed = False
+            elif passed is False and (m := re.match(r'\s*\\i_x\s.*\s([01xz]+)\s*$', line)):
+                # Undefined bits may take any value; choose zero.
+                counterexample = m.group(1).replace('x', '0').replace('z', '0')
+
+        return (passed, counterexample)
+
+    def _write_counterexample(self):
+        # Vector in the testbench's format (see: ReplayTestCase).
+        bits = self._counterexample.rjust(self._w, '0')[-self._w:]
+        groups = [bits[max(0, i - 8):i] for i in range(len(bits), 0, -8)]
+        with open(self._path / self._cex, 'w') as f:
+            f.write(f"{self._w}'b{'_'.join(reversed(groups))}\n")
+
+def run_equivalence_flow(**kwargs) -> dict:
+    from concurrent.futures import ThreadPoolExecutor
+
+    projects = kwargs.get('projects', {})
+    reference = kwargs.get('reference', 'spec')
+    reference_sources = kwargs.get('reference_sources', [])
+
+    runners = []
+    for design in kwargs.get('designs', []):
+        # Parameterizations of the design (default: one, at its defaults).
+        for params in kwargs.get('design_params', {}).get(design, [{}]):
+            suffix = ''.join(f'_{k.removeprefix("P_")}{v}'
+                             for k, v in params.items())
+            for w in kwargs.get('w_sweep', []):
+                for admit_compliment in kwargs.get('admit_compliment_sweep',
+                                                   [True]):
+                    a = 1 if admit_compliment else 0
+                    runners.append(EquivalenceRunner(
+                        path=pathlib.Path(
+                            f'{design}{suffix}_vs_{reference}_W{w}_A{a}'),
+                        design=design,
+                        reference=reference,
+                        w=w,
+                        admit_compliment=admit_compliment,
+                        params=params,
+                        sources=projects[design] + reference_sources,
+                        include_paths=kwargs.get('include_paths', []),
+                        miter_template=kwargs.get('miter_template'),
+                        echo=kwargs.get('echo', False),
+                    ))
+
+    # Proofs are independent; run concurrently (each in its own process).
+    jobs = kwargs.get('jobs') or os.cpu_count()
+    with ThreadPoolExecutor(max_workers=jobs) as pool:
+        for r, _ in zip(runners, pool.map(lambda r: r.run(), runners)):
+            status = 'PASS' if r.passed() else 'FAIL'
+            print(f'{r.name()}: {status}')
+            if r.counterexample():
+                print(f'  counterexample: {r.counterexample().resolve()}')
+
+    return {r.name(): r for r in runners}
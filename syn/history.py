@@ -0,0 +1,200 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import datetime
+import json
+import os
+import pathlib
+
+from cache import tool_version
+
+# PPA history: one JSON record per line, for each instance and corner of
+# each flow run. Records of a run share its 'run' identifier.
+
+def history_path(source_root) -> pathlib.Path:
+    # History of the tree at 'source_root', unless overridden by the
+    # U_SYN_HISTORY environment variable.
+    default = pathlib.Path(source_root) / 'syn' / 'ppa_history.jsonl'
+    return pathlib.Path(os.environ.get('U_SYN_HISTORY', default))
+
+def _git(source_root, *args) -> str:
+    from subprocess import run, PIPE, DEVNULL, SubprocessError
+
+    try:
+        p = run(['git', '-C', str(source_root), *args],
+                stdout=PIPE, stderr=DEVNULL, timeout=60)
+        if p.returncode == 0:
+            return p.stdout.decode().strip()
+    except (OSError, SubprocessError):
+        pass
+    return None
+
+def run_metadata(source_root) -> dict:
+    from cfg import OPENSTA_EXECUTABLE, SYNLIG_EXECUTABLE
+
+    now = datetime.datetime.now(datetime.timezone.utc)
+    commit = _git(source_root, 'rev-parse', 'HEAD')
+    return {
+        'run': now.strftime('%Y%m%dT%H%M%S.%fZ'),
+        'time': now.isoformat(timespec='seconds'),
+        'commit': commit,
+        # Uncommitted changes to the tree.
+        'dirty': bool(_git(source_root, 'status', '--porcelain',
+                           '--untracked-files=no')),
+        'tools': {
+            'synlig': tool_version(SYNLIG_EXECUTABLE, '-V'),
+            'opensta': tool_version(OPENSTA_EXECUTABLE, '-version'),
+        },
+    }
+
+def history_records(results: dict, meta: dict, corners: dict) -> list:
+    # 'results' as returned by run_synthesis_flow; 'corners' lists the
+    # corners of each library.
+    records = []
+    for library, ms in results.items():
+        for mode, ps in ms.items():
+            for project, ws in ps.items():
+                for w, r in ws.items():
+                    instance = {
+                        **meta,
+                        'library': library,
+                        'mode': mode,
+                        'project': project,
+                        'w': w,
+                        'passed': r.f_max() is not None,
+                        'cached': r.cached(),
+                        'runtime_syn': r.runtime().get('syn'),
+                        'runtime_sta': r.runtime().get('sta'),
+                    }
+                    for corner in corners[library]:
+                        rec = {**instance, 'corner': corner}
+                        if rec['passed']:
+                            rec.update({
+                                'total_area': r.total_area(),
+                                'sequential_area': r.sequential_area(),
+                                'combinatorial_area': r.combinatorial_area(),
+                                'f_max': r.f_max(corner),
+                                'slack': r.slack(corner),
+                            })
+                            if path := r.path(corner):
+                                rec.update({
+                                    'logic_depth': path.depth(),
+                                    'max_fanout': path.max_fanout(),
+                                })
+                            if corner == r.power_corner():
+                                rec.update({
+                                    'energy': r.energy(),
+                                    'leakage_power': r.leakage_power(),
+                                    'dynamic_power': r.dynamic_power(),
+                                })
+                        records.append(rec)
+    return records
+
+def append_history(path, records: list):
+    path = pathlib.Path(path)
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(path, 'a') as f:
+        for rec in records:
+            f.write(json.dumps(rec, sort_keys=True) + '\n')
+
+def load_history(path) -> dict:
+    # Records, by run (in the order in which runs were recorded).
+    runs = {}
+    with open(path) as f:
+        for line in f:
+            if line.strip():
+                rec = json.loads(line)
+                runs.setdefault(rec['run'], []).append(rec)
+    return runs
+
+def select_run(runs: dict, spec: str) -> str:
+    # A run identifier, or a commit (prefix), for which the latest run is
+    # selected.
+    if spec in runs:
+        return spec
+    for run in reversed(list(runs.keys())):
+        commit = runs[run][0].get('commit') or ''
+        if len(spec) >= 4 and commit.startswith(spec):
+            return run
+    return None
+
+# Metrics compared, and the direction of a regression: +1 if an increase is
+# worse, -1 if a decrease is.
+METRICS = {
+    'combinatorial_area': ('area', +1),
+    'f_max': ('f_max', -1),
+    'energy': ('power', +1),
+    'leakage_power': ('power', +1),
+}
+
+class Change:
+    def __init__(self, key: tuple, metric: str, baseline, current):
+        self.key = key
+        self.metric = metric
+        self.baseline = baseline
+        self.current = current
+
+    def percent(self) -> float:
+        if self.baseline in (None, 0) or self.current is None:
+            return None
+        return 100 * (self.current - self.baseline) / abs(self.baseline)
+
+    def __str__(self) -> str:
+        library, mode, project, w, corner = self.key
+        where = f'{project} W={w} {library} {mode} {corner}'
+        if self.current is None:
+            return f'{where}: failed (was passing)'
+        return (f'{where}: {self.metric} {self.baseline:0.4g} -> '
+                f'{self.current:0.4g} ({self.percent():+0.1f}%)')
+
+def compare_runs(baseline: list, current: list,
+                 thresholds: dict) -> tuple:
+    # Changes beyond the threshold (percent, by metric class: 'area',
+    # 'f_max', 'power'), as (regressions, improvements). Instances that
+    # failed, but passed in the baseline, are regressions.
+    def key(rec):
+        return (rec['library'], rec['mode'], rec['project'], rec['w'],
+                rec['corner'])
+
+    base = {key(rec): rec for rec in baseline}
+    regressions, improvements = [], []
+    for rec in current:
+        b = base.get(key(rec))
+        if b is None or not b['passed']:
+            continue
+        if not rec['passed']:
+            regressions.append(Change(key(rec), 'passed', True, None))
+            continue
+        for metric, (cls, sense) in METRICS.items():
+            change = Change(key(rec), metric, b.get(metric), rec.get(metric))
+            if (pct := change.percent()) is None:
+                continue
+            if sense * pct > thresholds[cls]:
+                regressions.append(change)
+            elif -sense * pct > thresholds[cls]:
+                improvements.append(change)
+    return (regressions, improvements)
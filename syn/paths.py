@@ -0,0 +1,129 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import collections
+import re
+
+class Stage:
+    # A cell on a timing path: its input and output (arc) delay, and the
+    # fanout of its output net.
+    def __init__(self, instance: str, cell: str, delay: float = 0.0,
+                 fanout: int = None):
+        self.instance = instance
+        self.cell = cell
+        self.delay = delay
+        self.fanout = fanout
+
+    def cell_type(self) -> str:
+        # Without the library prefix (for example, 'nand2_1').
+        return self.cell.rsplit('__', 1)[-1]
+
+class CriticalPath:
+    # Data path of an OpenSTA 'report_checks' (-fields {fanout}) report,
+    # from the launching register (or input) to the capturing one.
+    def __init__(self, startpoint: str = None, endpoint: str = None,
+                 stages: list = None, arrival: float = None):
+        self.startpoint = startpoint
+        self.endpoint = endpoint
+        self.stages = stages or []
+        self.arrival = arrival
+
+    @staticmethod
+    def parse(lines) -> 'CriticalPath':
+        # Parses the first path of the report; None if there is none.
+        path = None
+        in_path = False
+        for line in lines:
+            if m := re.match(r'Startpoint: (\S+)', line):
+                path = CriticalPath(startpoint=m.group(1))
+            elif path is None:
+                continue
+            elif m := re.match(r'Endpoint: (\S+)', line):
+                path.endpoint = m.group(1)
+            elif line.startswith('-----'):
+                in_path = True
+            elif not in_path:
+                continue
+            elif m := re.match(r'\s*(-?[\d\.]+)\s+data arrival time', line):
+                path.arrival = float(m.group(1))
+                return path
+            elif m := re.match(r'\s*(-?[\d\.]+)\s+-?[\d\.]+\s+[\^v]\s+'
+                               r'(\S+)/(\w+)\s+\((\S+)\)', line):
+                delay, instance, cell = float(m.group(1)), m.group(2), m.group(4)
+                if not path.stages or path.stages[-1].instance != instance:
+                    path.stages.append(Stage(instance, cell))
+                path.stages[-1].delay += delay
+            elif m := re.match(r'\s*(\d+)\s+\S+ \(net\)', line):
+                if path.stages:
+                    path.stages[-1].fanout = int(m.group(1))
+        return None
+
+    def logic(self) -> list:
+        # Combinational stages: all but the launching and capturing
+        # registers (where the path starts or ends at a register, rather
+        # than at a port).
+        stages = self.stages
+        if stages and stages[0].instance == self.startpoint:
+            stages = stages[1:]
+        if stages and stages[-1].instance == self.endpoint:
+            stages = stages[:-1]
+        return stages
+
+    def depth(self) -> int:
+        return len(self.logic())
+
+    def cell_mix(self) -> dict:
+        # Combinational stages, by cell type (most frequent first).
+        return dict(collections.Counter(
+            s.cell_type() for s in self.logic()).most_common())
+
+    def max_fanout(self) -> int:
+        return max((s.fanout or 0 for s in self.stages), default=0)
+
+    def to_dict(self) -> dict:
+        return {
+            'startpoint': self.startpoint,
+            'endpoint': self.endpoint,
+            'arrival': self.arrival,
+            'stages': [vars(s) for s in self.stages],
+        }
+
+    @staticmethod
+    def from_dict(d: dict) -> 'CriticalPath':
+        return CriticalPath(
+            startpoint=d['startpoint'],
+            endpoint=d['endpoint'],
+            stages=[Stage(**s) for s in d['stages']],
+            arrival=d['arrival'])
+
+    def __str__(self) -> str:
+        lines = [f'{self.startpoint} -> {self.endpoint}: '
+                 f'{self.arrival} ns, depth {self.depth()}']
+        for s in self.stages:
+            fanout = '' if s.fanout is None else f' (fanout {s.fanout})'
+            lines.append(f'  {s.delay:8.4f}  {s.instance} {s.cell}{fanout}')
+        return '\n'.join(lines)
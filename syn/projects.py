@@ -0,0 +1,102 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+# RTL sources of each project, relative to the RTL root.
+PROJECTS = {
+    # 'C'-Project
+    'c': [
+        'pipe/pipe_ctrl.sv',
+        'c/c_v_cell.sv',
+        'c/c_v.sv',
+        'c/c.sv',
+    ],
+    # 'E'-Project
+    'e': [
+        'pipe/pipe_ctrl.sv',
+        'e/e_is_1hot.sv',
+        'e/e.sv',
+    ],
+    # 'O'-Project
+    'o': [
+        'pipe/pipe_ctrl.sv',
+        'prefix/prefix_pkg.sv',
+        'prefix/prefix_inc.sv',
+        'o/o.sv',
+    ],
+    # 'P'-Project
+    'p': [
+        'pipe/pipe_ctrl.sv',
+        'prefix/prefix_pkg.sv',
+        'prefix/prefix_inc.sv',
+        'p/p_is_1hot.sv',
+        'p/p.sv',
+    ],
+    # 'U'-Project
+    'u': [
+        'pipe/pipe_ctrl.sv',
+        'u/u_mask.sv',
+        'u/u.sv',
+    ],
+    # PPA-selected implementation (of the above; see: selection.py).
+    'unary_detect': [
+        'pipe/pipe_ctrl.sv',
+        'prefix/prefix_pkg.sv',
+        'prefix/prefix_inc.sv',
+        'e/e_is_1hot.sv',
+        'e/e.sv',
+        'u/u_mask.sv',
+        'u/u.sv',
+        'p/p_is_1hot.sv',
+        'p/p.sv',
+        'c/c_v_cell.sv',
+        'c/c_v.sv',
+        'c/c.sv',
+        'o/o.sv',
+        'unary_detect/unary_detect_pkg.sv',
+        'unary_detect/unary_detect.sv',
+    ],
+}
+
+# Carry architectures (P_ADDER_ARCH, by name) of the incrementer-based
+# projects (see: rtl/prefix/prefix_pkg.sv).
+ADDER_ARCHS = {
+    'inferred': 0,
+    'ripple': 1,
+    'brent_kung': 2,
+    'sklansky': 3,
+    'kogge_stone': 4,
+    'han_carlson': 5,
+    'carry_select': 6,
+}
+
+ADDER_ARCH_PROJECTS = ['o', 'p']
+
+# Projects with one-hot detection by reduction tree (P_1HOT_TREE_EN).
+ONE_HOT_TREE_PROJECTS = ['e', 'p']
+
+def project_sources(rtl_root: str) -> dict:
+    return {k: [f'{rtl_root}/{f}' for f in v] for k, v in PROJECTS.items()}
@@ -0,0 +1,170 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import os
+import sys
+import time
+
+class Job:
+    def __init__(self, **kwargs):
+        self._name = kwargs.get('name')
+        self._fn = kwargs.get('fn')
+        self._deps = kwargs.get('deps', [])
+        # Estimated peak resident memory (MB).
+        self._memory_mb = kwargs.get('memory_mb', 0)
+        self._state = 'pending'
+        self._error = None
+        self._note = None
+        self._elapsed = None
+
+    def name(self) -> str:
+        return self._name
+
+    def deps(self) -> list:
+        return self._deps
+
+    def memory_mb(self) -> int:
+        return self._memory_mb
+
+    def done(self) -> bool:
+        return self._state in ('passed', 'failed', 'skipped')
+
+    def passed(self) -> bool:
+        return self._state == 'passed'
+
+    def state(self) -> str:
+        return self._state
+
+    def error(self):
+        return self._error
+
+    def note(self):
+        # Annotation returned by the job function (if any).
+        return self._note
+
+    def elapsed(self):
+        return self._elapsed
+
+    def _run(self):
+        start = time.monotonic()
+        try:
+            self._note = self._fn()
+            self._state = 'passed'
+        except Exception as e:
+            self._error = e
+            self._state = 'failed'
+        self._elapsed = time.monotonic() - start
+
+def physical_memory_mb() -> int:
+    try:
+        return (os.sysconf('SC_PAGE_SIZE') * os.sysconf('SC_PHYS_PAGES')) >> 20
+    except (ValueError, OSError, AttributeError):
+        return 0
+
+class Scheduler:
+    # Jobs are run concurrently, as soon as their dependencies have completed,
+    # subject to a cap on the number of concurrent jobs and on their total
+    # estimated memory. Job functions are expected to spend their time in
+    # child processes (Synlig, OpenSTA), and so are run from threads.
+    def __init__(self, **kwargs):
+        self._jobs_n = kwargs.get('jobs') or os.cpu_count() or 1
+        # Memory budget (MB); by default, 3/4 of physical memory.
+        self._memory_mb = (kwargs.get('memory_mb')
+                           or (physical_memory_mb() * 3) // 4)
+        self._progress = kwargs.get('progress', True)
+        self._jobs = []
+
+    def add(self, **kwargs) -> Job:
+        job = Job(**kwargs)
+        self._jobs.append(job)
+        return job
+
+    def jobs(self) -> list:
+        return self._jobs
+
+    def run(self) -> bool:
+        from concurrent.futures import ThreadPoolExecutor, wait, FIRST_COMPLETED
+
+        pending = list(self._jobs)
+        running = {}
+        memory_mb = 0
+        completed_n = 0
+        start = time.monotonic()
+
+        def report(job: Job):
+            nonlocal completed_n
+            completed_n += 1
+            if not self._progress:
+                return
+            elapsed = '' if job.elapsed() is None else f' ({job.elapsed():.1f}s)'
+            if job.note():
+                elapsed += f' [{job.note()}]'
+            print(f'[{completed_n}/{len(self._jobs)}] {job.state().upper()} '
+                  f'{job.name()}{elapsed} '
+                  f'[running: {len(running)}, '
+                  f'elapsed: {time.monotonic() - start:.0f}s]', flush=True)
+            if job.error() is not None:
+                print(f'  {job.error()!r}', file=sys.stderr, flush=True)
+
+        with ThreadPoolExecutor(max_workers=self._jobs_n) as pool:
+            while pending or running:
+                for job in list(pending):
+                    if any(d.done() and not d.passed() for d in job.deps()):
+                        # A dependency has failed; job cannot be run.
+                        job._state = 'skipped'
+                        pending.remove(job)
+                        report(job)
+                        continue
+                    if not all(d.passed() for d in job.deps()):
+                        continue
+                    if len(running) >= self._jobs_n:
+                        break
+                    # Admit job if it fits within the memory budget. A job
+                    # larger than the budget is run alone. Jobs are not
+                    # admitted out-of-order around a job awaiting memory,
+                    # such that large jobs are not starved.
+                    if running and (memory_mb + job.memory_mb() > self._memory_mb):
+                        break
+                    job._state = 'running'
+                    memory_mb += job.memory_mb()
+                    running[pool.submit(job._run)] = job
+                    pending.remove(job)
+
+                if not running:
+                    # Remaining jobs have unsatisfiable dependencies.
+                    for job in pending:
+                        job._state = 'skipped'
+                        report(job)
+                    break
+
+                done, _ = wait(running.keys(), return_when=FIRST_COMPLETED)
+                for f in done:
+                    job = running.pop(f)
+                    memory_mb -= job.memory_mb()
+                    report(job)
+
+        return all(job.passed() for job in self._jobs)
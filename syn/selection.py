@@ -0,0 +1,119 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import pathlib
+
+# Implementations from which unary_detect selects (see:
+# rtl/unary_detect/unary_detect.sv).
+IMPLEMENTATIONS = ['u', 'e', 'p', 'c', 'o']
+
+def selection_table(records: list, library: str = None,
+                    mode: str = 'area') -> dict:
+    # From PPA history records (of a run): (area, f_max) of each
+    # implementation, by W. f_max is that of the worst corner; failed
+    # instances are omitted.
+    table = {}
+    for rec in records:
+        if (rec['project'] not in IMPLEMENTATIONS) or (rec['mode'] != mode) \
+           or not rec['passed']:
+            continue
+        if library is None:
+            library = rec['library']
+        if rec['library'] != library:
+            continue
+        entry = table.setdefault(rec['w'], {})
+        area, f_max = entry.get(rec['project'], (None, None))
+        if f_max is not None:
+            f_max = min(f_max, rec['f_max'])
+        entry[rec['project']] = (rec['combinatorial_area'],
+                                 f_max if f_max is not None else rec['f_max'])
+    return dict(sorted(table.items()))
+
+def render_selection_package(table: dict, fn: pathlib.Path, source: str,
+                             header_fn: pathlib.Path = None):
+    # SystemVerilog package from which unary_detect selects its
+    # implementation at elaboration. The license header is retained from
+    # 'header_fn' (by default, any existing package).
+    header = []
+    header_fn = header_fn if header_fn is not None else fn
+    existing = header_fn.read_text().splitlines() if header_fn.exists() else []
+    if existing and existing[0].startswith('//='):
+        end = next((i for i, line in enumerate(existing[1:], 1)
+                    if line.startswith('//=')), None)
+        if end is not None:
+            header = existing[:end + 1] + ['']
+    lines = header + [
+        '// Generated by syn/selection.py; do not edit.',
+        f'// Source: {source}',
+        '',
+        'package unary_detect_pkg;',
+        '',
+        'typedef enum int {',
+        '  ' + ', '.join(f'IMPL_{p.upper()}' for p in IMPLEMENTATIONS),
+        '} impl_t;',
+        '',
+        '// Smallest implementation (post-synthesis combinatorial cell area)',
+        '// whose f_max meets \'target_mhz\' at width \'w\'; otherwise, the',
+        '// fastest. Widths between those measured take the measurements of',
+        '// the next wider, and those beyond, of the widest.',
+        'function automatic impl_t select_impl(int w, int target_mhz);',
+    ]
+    widths = list(table.keys())
+    for i, w in enumerate(widths):
+        entry = table[w]
+        if i == len(widths) - 1:
+            cond = 'begin' if i == 0 else 'else begin'
+        elif i == 0:
+            cond = f'if (w <= {w}) begin'
+        else:
+            cond = f'else if (w <= {w}) begin'
+        lines.append(f'  {cond}')
+        # By area; those no faster than a smaller are never selected.
+        candidates = []
+        for p, (area, f_max) in sorted(entry.items(),
+                                       key=lambda kv: (kv[1][0], kv[0])):
+            if candidates and (f_max <= entry[candidates[-1]][1]):
+                continue
+            candidates.append(p)
+        # The last (fastest) is that selected otherwise, such that it has
+        # no threshold of its own.
+        for p in candidates:
+            area, f_max = entry[p]
+            lines.append(f'    // {p}: {area:0.2f} um^2, {f_max:0.0f} MHz')
+            if p != candidates[-1]:
+                lines.append(f'    if (target_mhz <= {int(f_max)}) '
+                             f'return IMPL_{p.upper()};')
+        lines.append(f'    return IMPL_{candidates[-1].upper()};')
+        lines.append('  end')
+    if not widths:
+        lines.append(f'  return IMPL_{IMPLEMENTATIONS[-1].upper()};')
+    lines += [
+        'endfunction',
+        '',
+        'endpackage : unary_detect_pkg',
+    ]
+    fn.write_text('\n'.join(lines) + '\n')
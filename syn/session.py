@@ -0,0 +1,165 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+import itertools
+import re
+import threading
+
+class ToolSession:
+    # Long-running interactive tool process (OpenSTA, Yosys/Synlig) to which
+    # commands are sent over stdin. Each exchange is terminated by a sentinel
+    # which the tool is asked to print, such that output can be attributed
+    # to the commands that produced it. The prologue is run once per process
+    # (for example, to read the liberty). An interactive tool reports, but
+    # survives, a failed command; such exchanges are detected by the tool's
+    # error message and reported as failed.
+    _ids = itertools.count()
+
+    def __init__(self, **kwargs):
+        self._argv = kwargs.get('argv')
+        self._prologue = kwargs.get('prologue', [])
+        # Command to print a line (for example, 'puts {}').
+        self._print_cmd = kwargs.get('print_cmd')
+        # Interactive prompt (regex), removed from output.
+        self._prompt = re.compile(kwargs.get('prompt', '$^'))
+        # Error message (regex, matched at the start of a line).
+        self._error = re.compile(kwargs.get('error', '$^'))
+        self._p = None
+        self._sentinel = f'__u_session_{next(self._ids)}__'
+        self._n = 0
+
+    def run(self, cmds: list) -> tuple[int, str]:
+        # Returns (status, output); status is non-zero if the tool reported
+        # an error, or exited before completion (it is restarted for the
+        # next exchange).
+        if self._p is None:
+            self._start()
+        return self._exchange(cmds)
+
+    def close(self):
+        if self._p is None:
+            return
+        try:
+            self._p.stdin.write('exit\n')
+            self._p.stdin.close()
+            self._p.wait(timeout=10)
+        except Exception:
+            self._p.kill()
+        self._p = None
+
+    def _start(self):
+        from subprocess import Popen, PIPE, STDOUT
+        self._p = Popen(self._argv, stdin=PIPE, stdout=PIPE, stderr=STDOUT,
+                        text=True, bufsize=1)
+        ec, stdout = self._exchange(self._prologue)
+        if ec != 0:
+            raise RuntimeError(
+                f'Session failed to start: {" ".join(map(str, self._argv))}\n'
+                f'{stdout}')
+
+    def _exchange(self, cmds: list) -> tuple[int, str]:
+        self._n += 1
+        sentinel = f'{self._sentinel}{self._n}'
+        try:
+            for cmd in cmds:
+                self._p.stdin.write(f'{cmd}\n')
+            self._p.stdin.write(self._print_cmd.format(sentinel) + '\n')
+            self._p.stdin.flush()
+        except OSError:
+            pass
+
+        lines = []
+        failed = False
+        for line in self._p.stdout:
+            line = self._strip_prompts(line.rstrip('\n'))
+            if line == sentinel:
+                return (1 if failed else 0, '\n'.join(lines))
+            failed = failed or bool(self._error.match(line))
+            lines.append(line)
+
+        # Tool has exited.
+        self._p.wait()
+        self._p = None
+        return (1, '\n'.join(lines))
+
+    def _strip_prompts(self, line: str) -> str:
+        while m := self._prompt.match(line):
+            if not m.group(0):
+                break
+            line = line[m.end():]
+        return line
+
+class SessionPool:
+    # One session per worker thread, such that concurrent jobs each have a
+    # session of their own.
+    def __init__(self, **kwargs):
+        self._kwargs = kwargs
+        self._local = threading.local()
+        self._lock = threading.Lock()
+        self._sessions = []
+
+    def get(self) -> ToolSession:
+        if (session := getattr(self._local, 'session', None)) is None:
+            session = ToolSession(**self._kwargs)
+            self._local.session = session
+            with self._lock:
+                self._sessions.append(session)
+        return session
+
+    def close(self):
+        with self._lock:
+            for session in self._sessions:
+                session.close()
+            self._sessions = []
+
+def liberty_cmds(corners: dict) -> list:
+    # Define analysis corners, and read the liberty of each.
+    cmds = [f'define_corners {" ".join(corners.keys())}']
+    for corner, lib in corners.items():
+        cmds.append(f'read_liberty -corner {corner} {lib}')
+    return cmds
+
+def opensta_session_pool(corners: dict) -> SessionPool:
+    from cfg import OPENSTA_EXECUTABLE
+
+    return SessionPool(
+        argv=[OPENSTA_EXECUTABLE, '-no_splash'],
+        prologue=liberty_cmds(corners),
+        print_cmd='puts {}',
+        prompt=r'(% |sta> )',
+        error=r'Error: ',
+    )
+
+def synlig_session_pool() -> SessionPool:
+    from cfg import SYNLIG_EXECUTABLE
+
+    return SessionPool(
+        argv=[SYNLIG_EXECUTABLE, '-Q'],
+        print_cmd='log {}',
+        prompt=r'(yosys|synlig)( \[[^\]]*\])?> ',
+        error=r'ERROR: ',
+    )
@@ -0,0 +1,89 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+`include "common_defs.vh"
+
+// Behavioral specification of a unary-/thermometer-code detector, against
+// which the realizations are formally checked (see: syn/equiv.py). Mirrors
+// the testbench model (see: tb/stimulus.cc): a vector is admitted if it has
+// at most one edge (0->1 or 1->0 transition between adjacent bits), and, if
+// its MSB is set, only when complimented codes are admitted.
+
+module spec #(
+// ------------------------------------------------------------------------- //
+// Bit-Width
+  parameter int W
+// Enable admission of complimented unary code
+, parameter bit P_ADMIT_COMPLIMENT_EN
+) (
+// ------------------------------------------------------------------------- //
+// Input vector
+  input wire logic [W - 1:0]                     i_x
+
+// Admission Decision
+, output wire logic                              o_is_unary
+// Compliment form unary.
+, output wire logic                              o_is_compliment
+);
+
+// ========================================================================= //
+//                                                                           //
+// Wire(s)                                                                   //
+//                                                                           //
+// ========================================================================= //
+
+logic                        edge_any;
+logic                        edge_many;
+logic                        is_compliment;
+
+// ========================================================================= //
+//                                                                           //
+// Logic.                                                                    //
+//                                                                           //
+// ========================================================================= //
+
+always_comb begin: edge_PROC
+  edge_any = 'b0;
+  edge_many = 'b0;
+  for (int i = 1; i < W; i++) begin
+    edge_many = edge_many | (edge_any & (i_x[i] ^ i_x[i - 1]));
+    edge_any = edge_any | (i_x[i] ^ i_x[i - 1]);
+  end
+end: edge_PROC
+
+assign is_compliment = i_x[W - 1];
+
+// ========================================================================= //
+//                                                                           //
+// Output(s)                                                                 //
+//                                                                           //
+// ========================================================================= //
+
+assign o_is_unary = (~edge_many) & (P_ADMIT_COMPLIMENT_EN | (~is_compliment));
+assign o_is_compliment = P_ADMIT_COMPLIMENT_EN & is_compliment;
+
+endmodule : spec
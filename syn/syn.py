@@ -25,35 +25,114 @@
 ## POSSIBILITY OF SUCH DAMAGE.
 ##========================================================================== //
 
+import json
+import math
 import os
 import pathlib
+import time
+from typing import Optional
+
+from cache import (ResultCache, digest, file_digest, normalise_paths,
+                   tool_version)
+from area import Attribution
+from paths import CriticalPath
+from scheduler import Scheduler
+from session import liberty_cmds, opensta_session_pool, synlig_session_pool
 
 class SynligRunner:
     def __init__(self, **kwargs):
         self._path = kwargs.get('path')
         self._project = kwargs.get('project')
         self._w = kwargs.get('w')
-        self._sources = kwargs.get('sources', [])
+        # Copied; the rendered top-level is appended per-instance.
+        self._sources = list(kwargs.get('sources', []))
         self._include_paths = kwargs.get('include_paths', [])
         self._syn_v = kwargs.get('syn_v', 'syn.v')
+        self._syn_sim_v = kwargs.get('syn_sim_v', 'syn_sim.v')
         self._script_tcl = kwargs.get('script_tcl', 'synlig.tcl')
         self._top_level_template = kwargs.get('top_level_template')
         self._top_sv = kwargs.get('top_sv', 'top.sv')
         self._echo =  kwargs.get('echo', False)
+        self._cache = kwargs.get('cache')
+        # Persistent Synlig sessions (if any).
+        self._sessions = kwargs.get('sessions')
+        # ABC delay target (ps); otherwise, mapped for area.
+        self._delay_target = kwargs.get('delay_target')
+        # Other (RTL) parameters of the design, by name; otherwise, at
+        # their defaults.
+        self._params = kwargs.get('params', {})
+        # Register stages appended to the design (see: top.sv.tmpl), which
+        # are retimed into its logic.
+        self._retime_stages = kwargs.get('retime_stages', 0)
+        # Liberty against which the design is mapped.
+        self._liberty = kwargs.get('liberty')
+        if self._liberty is None:
+            from cfg import STDCELL_LIB_PATH
+            self._liberty = STDCELL_LIB_PATH
         self._total_area = None
         self._sequential_area = None
 
-    def run(self):
+    def run(self) -> Optional[str]:
+        # Returns a note on the run ('cached', where the result was taken
+        # from the cache), if any.
         self._render_toplevel()
         self._render_synlig_script()
+
+        key = self._cache_key() if self._cache else None
+        if key and (r := self._cache.load(key, self._path)):
+            self._total_area = r['total_area']
+            self._sequential_area = r['sequential_area']
+            return 'cached'
+
         ec, stdout = self._run_synlig()
         if self._echo:
             print(stdout)
+        if ec != 0:
+            # Tool reported an error, or exited; its output is not trusted.
+            return None
         self._total_area, self._sequential_area = self._scan_synlig_output(stdout)
 
+        if key and (self._total_area is not None):
+            self._cache.store(key, {
+                'total_area': self._total_area,
+                'sequential_area': self._sequential_area,
+            }, self._path, self._outputs())
+
     def area(self) -> tuple[float, float]:
         return (self._total_area, self._sequential_area)
 
+    def _cache_key(self) -> str:
+        from cfg import SYNLIG_EXECUTABLE
+
+        # RTL sources (including the rendered top-level) and the headers
+        # they may include.
+        sources = [pathlib.Path(src) for src in self._sources]
+        for include_path in self._include_paths:
+            sources += sorted(pathlib.Path(include_path).glob('*.vh'))
+
+        # The script names its sources, include paths, liberty and outputs
+        # by absolute path; each is replaced by its digest (or, for
+        # directories, a placeholder) such that the key is unaffected by
+        # the location of the tree and of the build.
+        tokens = {str(src): file_digest(src) for src in self._sources}
+        tokens.update({str(include_path): f'<include{i}>'
+                       for i, include_path in enumerate(self._include_paths)})
+        tokens[str(self._liberty)] = file_digest(self._liberty)
+        tokens[str(self._path.resolve())] = '<path>'
+        script = normalise_paths(
+            (self._path / self._script_tcl).read_text(), tokens)
+
+        return digest(
+            'syn',
+            self._project,
+            self._w,
+            True,  # Compliment admission
+            *[file_digest(src) for src in sources],
+            script,
+            tool_version(SYNLIG_EXECUTABLE, '-V'),
+            file_digest(self._liberty),
+        )
+
     def _render_toplevel(self):
         import jinja2
 
@@ -67,48 +146,105 @@ class SynligRunner:
             'W': self._w,
             'ADMIT_COMPLIMENT_EN': to_verilog_parameter(True),
             'unary_detector': self._project,
+            'PARAMS': ''.join(f', .{k}({v})' for k, v in self._params.items()),
+            'RETIME_STAGES': self._retime_stages,
         }
 
         top_level_out = self._path / self._top_sv
         top_level_out.write_text(t.render(env))
         self._sources.append(str(top_level_out.resolve()))
 
-    def _render_synlig_script(self):
-        from cfg import STDCELL_LIB_PATH
+    def _outputs(self) -> tuple:
+        # Output files (relative to the path), as restored from the cache.
+        return (self._syn_v, self._syn_sim_v)
 
+    def _render_synlig_script(self):
         with open(self._path / self._script_tcl, 'w') as f:
             f.write(f'# Synlig script\n')
             f.write(f'# Project: {self._project}\n')
+            if self._delay_target:
+                f.write(f'# Delay target: {self._delay_target} ps\n')
+            if self._retime_stages:
+                f.write(f'# Retiming stages: {self._retime_stages}\n')
+            f.write('\n'.join(self._synlig_cmds()) + '\n')
 
-            cmds = []
- 
-            include_files = [
-                f'-I{include_path}' for include_path in self._include_paths]
+    def _read_cmds(self) -> list:
+        include_files = [
+            f'-I{include_path}' for include_path in self._include_paths]
 
-            for src in self._sources:
-                cmds.append(f'read_systemverilog {" ".join(include_files)} -defer {src}')
+        cmds = []
+        for src in self._sources:
+            cmds.append(f'read_systemverilog {" ".join(include_files)} -defer {src}')
+        return cmds + [
+            'read_systemverilog -link',
+            'hierarchy -check -top top',
+        ]
 
-            cmds += [
-                'read_systemverilog -link',
-                'hierarchy -check -top top',
+    def _synlig_cmds(self) -> list:
+        # Outputs are absolute, such that the script may be run from a
+        # session in any directory.
+        syn_v = (self._path / self._syn_v).resolve()
+        syn_sim_v = (self._path / self._syn_sim_v).resolve()
+
+        return self._read_cmds() + self._techmap_cmds() + [
+            f'dfflibmap -liberty {self._liberty}',
+            self._abc_cmd(),
+            'opt',
+            'opt_clean -purge',
+            'check',
+            f'write_verilog -noattr -noexpr {syn_v}',
+            f'stat -liberty {self._liberty}',
+            # Behavioral netlist for simulation: cells are replaced by
+            # their Liberty functions.
+            f'read_liberty -ignore_miss_func {self._liberty}',
+            'hierarchy -top top',
+            'flatten',
+            'hierarchy -top top',
+            'opt_clean -purge',
+            f'write_verilog -noattr {syn_sim_v}',
+        ]
+
+    def _techmap_cmds(self) -> list:
+        # Flattened, and mapped to generic cells.
+        if not self._retime_stages:
+            return [
                 'flatten',
                 'proc',
                 'opt',
                 'dfflegalize',
                 'techmap',
-                f'dfflibmap -liberty {STDCELL_LIB_PATH}',
-                f'abc -liberty {STDCELL_LIB_PATH}',
-                'opt',
-                'opt_clean -purge',
-                'check',
-                f'write_verilog -noattr -noexpr {self._syn_v}',
-                f'stat -liberty {STDCELL_LIB_PATH}',
             ]
-            f.write('\n'.join(cmds) + '\n')
+        # The flops of the retiming module (alone) are passed through ABC,
+        # which retimes them into its logic, before the design is flattened.
+        return [
+            'setattr -mod -set keep_hierarchy 1 top_retime',
+            'flatten',
+            'proc',
+            'opt',
+            'dfflegalize',
+            'techmap',
+            'opt',
+            f'{self._abc_cmd()} -dff top_retime',
+            'setattr -mod -unset keep_hierarchy top_retime',
+            'flatten',
+        ]
+
+    def _abc_cmd(self) -> str:
+        if self._delay_target:
+            # Delay-oriented mapping, to the target period.
+            return f'abc -D {self._delay_target} -liberty {self._liberty}'
+        return f'abc -liberty {self._liberty}'
 
-    def _run_synlig(self) -> int:
+    def _run_synlig(self) -> tuple[int, str]:
         from cfg import SYNLIG_EXECUTABLE
 
+        if self._sessions:
+            script_tcl = (self._path / self._script_tcl).resolve()
+            return self._sessions.get().run([
+                'design -reset',
+                f'script {script_tcl}',
+            ])
+
         from subprocess import Popen, PIPE
         p = Popen([SYNLIG_EXECUTABLE, '-s', self._script_tcl],
             stdout=PIPE, stderr=PIPE, cwd=self._path)
@@ -129,59 +265,440 @@ class SynligRunner:
 
         return (total_area, sequential_area)
 
+class AttributionRunner(SynligRunner):
+    # Synthesis that preserves hierarchy, from which cell area is
+    # attributed by module, generate block and cell type. Hierarchy limits
+    # optimization across module boundaries, so that totals may exceed
+    # those of (flattened) synthesis.
+    def __init__(self, **kwargs):
+        super().__init__(**kwargs)
+        self._attribution = None
+
+    def run(self) -> Optional[str]:
+        note = super().run()
+        if self._total_area is not None:
+            self._attribution = Attribution.parse(
+                self._path / self._syn_v, self._liberty)
+            with open(self._path / 'area.json', 'w') as f:
+                json.dump(self._attribution.to_dict(), f, indent=1)
+        return note
+
+    def attribution(self) -> Attribution:
+        return self._attribution
+
+    def _outputs(self) -> tuple:
+        return (self._syn_v,)
+
+    def _synlig_cmds(self) -> list:
+        syn_v = (self._path / self._syn_v).resolve()
+
+        return self._read_cmds() + [
+            'proc',
+            'opt',
+            'dfflegalize',
+            'techmap',
+            f'dfflibmap -liberty {self._liberty}',
+            self._abc_cmd(),
+            'opt',
+            'opt_clean -purge',
+            f'write_verilog -noattr -noexpr {syn_v}',
+            f'stat -liberty {self._liberty}',
+        ]
+
+class EstimateRunner(SynligRunner):
+    # Fast, technology-independent pre-map: generic cell count (an area
+    # proxy) and the longest topological path (logic depth), without
+    # technology mapping.
+    def __init__(self, **kwargs):
+        super().__init__(**kwargs)
+        self._cells = None
+        self._depth = None
+
+    def run(self) -> Optional[str]:
+        self._render_toplevel()
+        self._render_synlig_script()
+
+        key = self._cache_key() if self._cache else None
+        if key and (r := self._cache.load(key)):
+            self._cells, self._depth = r['cells'], r['depth']
+            return 'cached'
+
+        ec, stdout = self._run_synlig()
+        if self._echo:
+            print(stdout)
+        if ec != 0:
+            # Tool reported an error, or exited; its output is not trusted.
+            return None
+        self._cells, self._depth = self._scan_estimate_output(stdout)
+
+        if key and (self._cells is not None):
+            self._cache.store(key, {'cells': self._cells, 'depth': self._depth})
+
+    def estimate(self) -> tuple:
+        # (cells, depth)
+        return (self._cells, self._depth)
+
+    def _synlig_cmds(self) -> list:
+        return self._read_cmds() + [
+            'flatten',
+            'proc',
+            'opt',
+            'techmap',
+            'opt -fast',
+            'ltp -noff',
+            'stat',
+        ]
+
+    def _scan_estimate_output(self, stdout: str):
+        import re
+
+        cells = None
+        depth = None
+        for line in stdout.splitlines():
+            if m := re.search(r'Longest topological path in \S+ \(length=(\d+)\)', line):
+                depth = int(m.group(1))
+            elif m := re.match(r'\s*(?:Number of cells:\s+(\d+)|(\d+)\s+cells$)', line):
+                cells = int(m.group(1) or m.group(2))
+        if depth is None:
+            return (None, None)
+        return (cells, depth)
+
+# FPGA families: Yosys synthesis command, the cells counted as LUTs and as
+# carry logic (by pattern), and the nextpnr (if any) by which timing is
+# analyzed, with its device arguments.
+FPGA_FAMILIES = {
+    'xilinx': {
+        'synth': 'synth_xilinx -flatten',
+        'lut': r'LUT\d',
+        'carry': r'CARRY\d',
+        'nextpnr': None,
+    },
+    'ice40': {
+        'synth': 'synth_ice40',
+        'lut': r'SB_LUT4',
+        'carry': r'SB_CARRY',
+        'nextpnr': ('nextpnr-ice40',
+                    ['--hx8k', '--package', 'ct256',
+                     '--pcf-allow-unconstrained']),
+    },
+    'ecp5': {
+        'synth': 'synth_ecp5',
+        'lut': r'LUT4',
+        'carry': r'CCU2[CD]',
+        'nextpnr': ('nextpnr-ecp5', ['--85k', '--package', 'CABGA756']),
+    },
+}
+
+class FpgaRunner(SynligRunner):
+    # Synthesis by Yosys' built-in flow for an FPGA family: LUT and carry
+    # cell counts, and logic levels (the longest path, in cells). Where the
+    # family's nextpnr is installed, the design is also placed and routed
+    # for its f_max.
+    def __init__(self, **kwargs):
+        super().__init__(**kwargs)
+        self._family = kwargs.get('family')
+        self._frequency = kwargs.get('frequency', 1000)
+        self._json = 'fpga.json'
+        self._luts = None
+        self._carries = None
+        self._levels = None
+        self._f_max = None
+
+    def run(self) -> Optional[str]:
+        import shutil
+
+        self._render_toplevel()
+        self._render_synlig_script()
+
+        nextpnr = FPGA_FAMILIES[self._family]['nextpnr']
+        if nextpnr and not shutil.which(nextpnr[0]):
+            nextpnr = None
+
+        key = self._cache_key() if self._cache else None
+        if key:
+            key = digest(key, nextpnr and tool_version(
+                shutil.which(nextpnr[0]), '--version'))
+        if key and (r := self._cache.load(key)):
+            self._luts, self._carries = r['luts'], r['carries']
+            self._levels, self._f_max = r['levels'], r['f_max']
+            return 'cached'
+
+        ec, stdout = self._run_synlig()
+        if self._echo:
+            print(stdout)
+        if ec != 0:
+            # Tool reported an error, or exited; its output is not trusted.
+            return None
+        self._luts, self._carries, self._levels = \
+            self._scan_fpga_output(stdout)
+        if nextpnr and (self._luts is not None):
+            self._f_max = self._run_nextpnr(nextpnr)
+
+        if key and (self._luts is not None):
+            self._cache.store(key, {
+                'luts': self._luts,
+                'carries': self._carries,
+                'levels': self._levels,
+                'f_max': self._f_max,
+            })
+
+    def luts(self) -> int:
+        return self._luts
+
+    def carries(self) -> int:
+        return self._carries
+
+    def levels(self) -> int:
+        return self._levels
+
+    def f_max(self) -> float:
+        # Post-route (MHz), if analyzed.
+        return self._f_max
+
+    def _synlig_cmds(self) -> list:
+        json_file = (self._path / self._json).resolve()
+
+        return self._read_cmds() + [
+            f'{FPGA_FAMILIES[self._family]["synth"]} -top top',
+            'stat',
+            'ltp -noff',
+            f'write_json {json_file}',
+        ]
+
+    def _run_nextpnr(self, nextpnr) -> float:
+        import re
+        from subprocess import run, PIPE, STDOUT
+
+        exe, device_args = nextpnr
+        p = run([exe, *device_args, '--json', self._json,
+                 '--freq', str(self._frequency), '--timing-allow-fail'],
+                stdout=PIPE, stderr=STDOUT, cwd=self._path)
+        f_max = None
+        # The last report is that after routing.
+        for m in re.finditer(r'Max frequency for clock \'[^\']*\': ([\d\.]+) MHz',
+                             p.stdout.decode()):
+            f_max = float(m.group(1))
+        return f_max
+
+    def _scan_fpga_output(self, stdout: str):
+        import re
+
+        family = FPGA_FAMILIES[self._family]
+        luts, carries, levels = 0, 0, None
+        for line in stdout.splitlines():
+            if line.startswith('==='):
+                # Counts of the (last) module reported.
+                luts, carries = 0, 0
+            elif m := re.search(r'Longest topological path in \S+ \(length=(\d+)\)', line):
+                levels = int(m.group(1))
+            elif m := re.match(r'\s+(?:(\w+)\s+(\d+)|(\d+)\s+(\w+))$', line):
+                cell = m.group(1) or m.group(4)
+                n = int(m.group(2) or m.group(3))
+                if re.fullmatch(family['lut'], cell):
+                    luts += n
+                elif re.fullmatch(family['carry'], cell):
+                    carries += n
+        if levels is None:
+            return (None, None, None)
+        return (luts, carries, levels)
+
 class OpenSTARunner:
+    # Reported precision (decimal places, ns).
+    DIGITS = 4
+
     def __init__(self, **kwargs):
+        from cfg import STDCELL_LIB_PATH
+
         self._top = kwargs.get('top', 'top')
         self._syn_v = kwargs.get('syn_v', 'syn.v')
         self._project = kwargs.get('project')
         self._path = kwargs.get('path')
         self._frequency = kwargs.get('frequency')
-        self._sdc_file = 'design.sdc'
-        self._opensta_file = 'opensta.tcl'
+        # Clock period (ns); by default, that of the frequency (MHz).
+        self._period = kwargs.get('period', 1000 / self._frequency)
+        # Liberty of each corner at which timing is analyzed, by name.
+        self._corners = kwargs.get('corners', {'default': STDCELL_LIB_PATH})
+        # Switching activity (see: tb --activity) from which power is
+        # estimated at 'power_corner'; otherwise, power is not reported.
+        self._activity = kwargs.get('activity')
+        self._power_corner = kwargs.get('power_corner')
+        if self._power_corner is None:
+            self._power_corner = next(iter(self._corners))
+        self._w = kwargs.get('w')
+        # Distinguishes the files of analyses of the same instance.
+        tag = kwargs.get('tag', f'F{self._frequency}')
+        self._sdc_file = f'design_{tag}.sdc'
+        self._opensta_file = f'opensta_{tag}.tcl'
         self._echo = kwargs.get('echo', False)
-        self._passed = False
+        self._cache = kwargs.get('cache')
+        # Persistent OpenSTA sessions (if any), with the liberties
+        # pre-loaded.
+        self._sessions = kwargs.get('sessions')
+        # Outcome, by corner: (passed, worst slack, arrival)
+        self._results = {}
+        # Critical path, by corner.
+        self._paths = {}
+        # Power (W): (internal, switching, leakage, total)
+        self._power = None
 
-    def run(self):
+    def run(self) -> Optional[str]:
         self._render_sdc()
         self._render_opensta_script()
+
+        key = self._cache_key() if self._cache else None
+        if key and (r := self._cache.load(key)):
+            self._results = {k: tuple(v) for k, v in r['corners'].items()}
+            self._paths = {k: CriticalPath.from_dict(v)
+                           for k, v in r['paths'].items()}
+            self._power = r['power'] and tuple(r['power'])
+            return 'cached'
+
         ec, stdout = self._run_opensta()
         if self._echo:
             print(stdout)
         if ec != 0:
-            pass
-        self._passed = self._scan_opensta_output(stdout)
+            # Tool reported an error, or exited; its output is not trusted.
+            return None
+        self._results, self._paths, self._power = \
+            self._scan_opensta_output(stdout)
+
+        if key and self._complete():
+            self._cache.store(key, {
+                'corners': self._results,
+                'paths': {k: v.to_dict() for k, v in self._paths.items()},
+                'power': self._power,
+            })
 
     def passed(self) -> bool:
-        return self._passed
+        # Timing is met at all corners.
+        return self._complete() and all(r[0] for r in self._results.values())
+
+    def period(self) -> float:
+        return self._period
+
+    def corners(self) -> list:
+        return list(self._corners.keys())
+
+    def worst_slack(self, corner: str = None) -> float:
+        # Worst (setup) slack (ns), at a corner or over all corners.
+        return self._worst(corner, 1, min)
+
+    def arrival(self, corner: str = None) -> float:
+        # Data arrival time of the critical path (ns), at a corner or the
+        # latest over all corners.
+        return self._worst(corner, 2, max)
+
+    def min_period(self, corner: str = None) -> float:
+        # Minimum period (ns) at which timing is met at a corner (or at all
+        # corners); single-clock design, so that setup slack varies
+        # one-for-one with the period. The period is rounded up to the
+        # picosecond, allowing for rounding of the reported slack.
+        if (slack := self.worst_slack(corner)) is None:
+            return None
+        t = self._period - slack + (0.5 * 10 ** -self.DIGITS)
+        return math.ceil(t * 1000) / 1000
+
+    def path(self, corner: str = None) -> CriticalPath:
+        # Critical path at a corner, or at the worst corner.
+        if corner is None:
+            corner = max(self._results, default=None,
+                         key=lambda c: self._results[c][2] or 0)
+        return self._paths.get(corner)
+
+    def power(self) -> tuple:
+        # (internal, switching, leakage, total) power (W), if estimated.
+        return self._power
+
+    def power_corner(self) -> str:
+        return self._power_corner if self._activity else None
+
+    def _complete(self) -> bool:
+        return all((c in self._results) and (self._results[c][1] is not None)
+                   for c in self._corners)
+
+    def _worst(self, corner: str, i: int, f):
+        if corner is not None:
+            r = self._results.get(corner)
+            return None if r is None else r[i]
+        if not self._complete():
+            return None
+        return f(self._results[c][i] for c in self._corners)
+
+    def _cache_key(self) -> str:
+        from cfg import OPENSTA_EXECUTABLE
+
+        # Keyed on the netlist rather than on its sources, such that an
+        # unchanged netlist is not re-analyzed. As for synthesis, paths
+        # named by the script are replaced by digests (or placeholders).
+        tokens = {str(lib): file_digest(lib) for lib in self._corners.values()}
+        if self._activity:
+            tokens[str(pathlib.Path(self._activity).resolve())] = \
+                file_digest(self._activity)
+        tokens[str(self._path.resolve())] = '<path>'
+        script = normalise_paths(
+            (self._path / self._opensta_file).read_text(), tokens)
+
+        return digest(
+            'sta',
+            self._project,
+            self._frequency,
+            self._path / self._syn_v,
+            self._path / self._sdc_file,
+            script,
+            tool_version(OPENSTA_EXECUTABLE, '-version'),
+            *[f'{c}:{file_digest(lib)}' for c, lib in self._corners.items()],
+            # The script names, but does not include, the activity.
+            file_digest(self._activity) if self._activity else None,
+        )
 
     def _render_sdc(self):
         with open(self._path / self._sdc_file, 'w') as f:
             f.write(f'# SDC file\n')
             f.write(f'# Project: {self._project}\n')
-            f.write(f'# Frequency: {self._frequency} MHz\n')
-            period_ns = 1000 / self._frequency
-            f.write(f'create_clock -name clk -period {period_ns:.3f} [get_ports clk]\n')
+            f.write(f'# Frequency: {self._frequency:g} MHz\n')
+            f.write(f'create_clock -name clk -period {self._period:.3f} [get_ports clk]\n')
 
     def _render_opensta_script(self):
-        from cfg import STDCELL_LIB_PATH
-
         with open(self._path / self._opensta_file, 'w') as f:
             f.write(f'# OpenSTA script\n')
             f.write(f'# Project: {self._project}\n')
-            f.write(f'# Frequency: {self._frequency} MHz\n')
-            cmds = [
-                f'read_liberty {STDCELL_LIB_PATH}',
+            f.write(f'# Frequency: {self._frequency:g} MHz\n')
+            cmds = []
+            if not self._sessions:
+                cmds += liberty_cmds(self._corners)
+            cmds += [
+                # Replaces the design (and constraints) of any prior analysis.
                 f'read_verilog {self._syn_v}',
                 f'link_design {self._top}',
                 f'read_sdc {self._sdc_file}',
-                f'report_checks',
             ]
+            for corner in self._corners:
+                cmds += [
+                    f'puts "Corner: {corner}"',
+                    f'report_checks -path_delay max -corner {corner} '
+                    f'-fields {{fanout}} -digits {self.DIGITS}',
+                    f'report_worst_slack -max -corner {corner} -digits {self.DIGITS}',
+                ]
+            if self._activity:
+                cmds += [
+                    # Width selects per-bit activity, where it applies.
+                    f'set u_w {self._w}',
+                    f'source {pathlib.Path(self._activity).resolve()}',
+                    f'puts "Power: {self._power_corner}"',
+                    f'report_power -corner {self._power_corner} -digits 6',
+                ]
             f.write('\n'.join(cmds) + '\n')
 
 
-    def _run_opensta(self) -> int:
+    def _run_opensta(self) -> tuple[int, str]:
         from cfg import OPENSTA_EXECUTABLE
 
+        if self._sessions:
+            return self._sessions.get().run([
+                f'cd {self._path.resolve()}',
+                f'source {self._opensta_file}',
+            ])
+
         from subprocess import Popen, PIPE
         p = Popen([OPENSTA_EXECUTABLE, self._opensta_file],
             stdout=PIPE, stderr=PIPE, cwd=self._path)
@@ -191,34 +708,124 @@ class OpenSTARunner:
     def _scan_opensta_output(self, stdout: str):
         import re
 
-        passed = True
+        results = {}
+        paths = {}
+        power = None
+        corner = None
+        in_power = False
+        passed, worst_slack, arrival = True, None, None
+        lines = []
+
+        def close():
+            results[corner] = (passed, worst_slack, arrival)
+            if path := CriticalPath.parse(lines):
+                paths[corner] = path
+
         for line in stdout.splitlines():
-            if re.search(r'slack \(VIOLATED\)', line):
+            if m := re.match(r'(Corner|Power): (\S+)', line):
+                if corner is not None:
+                    close()
+                corner = m.group(2) if m.group(1) == 'Corner' else None
+                in_power = (m.group(1) == 'Power')
+                passed, worst_slack, arrival = True, None, None
+                lines = []
+                continue
+            lines.append(line)
+            if in_power:
+                if m := re.match(r'Total' + 4 * r'\s+([-+\d\.eE]+)', line):
+                    power = tuple(float(m.group(i)) for i in range(1, 5))
+            elif re.search(r'slack \(VIOLATED\)', line):
                 passed = False
+            elif m := re.search(r'worst slack (-?[\d\.]+)', line):
+                worst_slack = float(m.group(1))
+            elif arrival is None and \
+                 (m := re.match(r'\s*([\d\.]+)\s+data arrival time', line)):
+                arrival = float(m.group(1))
+        if corner is not None:
+            close()
+
+        return (results, paths, power)
 
-        return passed
+def synthesis_memory_mb(w: int) -> int:
+    # Coarse estimate of peak Synlig memory, which grows with the flattened
+    # design (and so with W).
+    return 512 + 16 * w
+
+def sta_memory_mb(w: int) -> int:
+    return 128 + 2 * w
+
+def instance_name(project: str, w: int, library_tag: str = None,
+                  delay_target_frequency: int = None,
+                  params: dict = {}, retime_stages: int = 0) -> str:
+    name = f'{project}_W{w}'
+    if library_tag:
+        name += f'_{library_tag}'
+    if delay_target_frequency:
+        name += f'_D{delay_target_frequency}'
+    if retime_stages:
+        name += f'_R{retime_stages}'
+    for k, v in params.items():
+        name += f'_{k.removeprefix("P_")}{v}'
+    return name
 
 class InstanceRunner:
     def __init__(self, **kwargs):
         self._project = kwargs.get('project')
-        self._frequency_sweep = kwargs.get('frequency_sweep', [])
+        # Frequency (MHz) of the analysis from which f_max is derived.
+        self._reference_frequency = kwargs.get('reference_frequency', 1000)
+        # Confirm f_max by a second analysis.
+        self._confirm = kwargs.get('confirm', False)
+        # Frequency (MHz) targeted by timing-driven synthesis; otherwise,
+        # synthesis is area-driven.
+        self._delay_target_frequency = kwargs.get('delay_target_frequency')
+        # Liberty against which the design is synthesized, and of each
+        # corner at which it is analyzed (by default, that of synthesis).
+        self._liberty = kwargs.get('liberty')
+        self._corners = kwargs.get('corners')
+        # Switching activity, and the corner at which power is estimated.
+        self._activity = kwargs.get('activity')
+        self._power_corner = kwargs.get('power_corner')
+        # Attribute area by module, generate block and cell type (by
+        # additional, hierarchical synthesis).
+        self._attribution = kwargs.get('attribution', False)
+        self._ar = None
+        # Other RTL parameters, by name.
+        self._params = kwargs.get('params', {})
+        # Register stages retimed into the design (see: top.sv.tmpl).
+        self._retime_stages = kwargs.get('retime_stages', 0)
         self._w = kwargs.get('w', [])
         self._top_level_template = kwargs.get('top_level_template')
         self._sources = kwargs.get('sources', [])
         self._include_paths = kwargs.get('include_paths', [])
-        self._instance_name = f'{self._project}_W{self._w}'
+        # Distinguished by library (other than the first), timing-driven
+        # target, parameters and retiming stages.
+        self._instance_name = instance_name(
+            self._project, self._w, kwargs.get('library_tag'),
+            self._delay_target_frequency, self._params, self._retime_stages)
         self._instance_path = pathlib.Path(self._instance_name)
         self._instance_path.mkdir(exist_ok=True)
         self._echo = kwargs.get('echo', False)
+        self._cache = kwargs.get('cache')
+        # Session pools (if any), by tool.
+        self._sessions = kwargs.get('sessions', {})
 
         self._script_tcl = 'synlig.tcl'
         self._sr = None
         self._f_max = None
-        self._f_min = None
-
-    def run(self):
-        print(f'Running instance: {self._instance_name}')
+        self._f_max_by_corner = {}
+        self._critical_path = None
+        self._power = None
+        self._slack_by_corner = {}
+        # Critical path, by corner, and at the worst corner.
+        self._paths = {}
+        self._worst_path = None
+        # Elapsed time (s) of each step, and whether it was a cache hit.
+        self._runtime = {}
+        self._cached = {}
 
+    def submit(self, sched: Scheduler):
+        # Synthesis, then timing analysis. f_max is derived from the worst
+        # slack at a reference frequency, rather than by a sweep.
         syn_v = 'syn.v'
 
         args = {
@@ -230,32 +837,126 @@ class InstanceRunner:
             'include_paths': self._include_paths,
             'top_level_template': self._top_level_template,
             'echo': self._echo,
+            'cache': self._cache,
+            'sessions': self._sessions.get('synlig'),
+            'liberty': self._liberty,
+            'params': self._params,
+            'retime_stages': self._retime_stages,
         }
+        if self._delay_target_frequency:
+            args['delay_target'] = round(1e6 / self._delay_target_frequency)
         self._sr = SynligRunner(**args)
-        self._sr.run()
 
-        for frequency in self._frequency_sweep:
+        def synthesize():
+            start = time.monotonic()
+            note = self._sr.run()
+            self._runtime['syn'] = time.monotonic() - start
+            self._cached['syn'] = (note == 'cached')
+            if self._sr.area()[0] is None:
+                raise RuntimeError(f'Synthesis failed: {self._instance_name}')
+            return note
+
+        syn_job = sched.add(
+            name=f'{self._instance_name}/syn',
+            fn=synthesize,
+            memory_mb=synthesis_memory_mb(self._w))
+
+        if self._attribution:
+            # Hierarchical synthesis, independent of the above.
+            hier_path = self._instance_path / 'hier'
+            hier_path.mkdir(exist_ok=True)
+            self._ar = AttributionRunner(
+                **dict(args, path=hier_path, syn_v='hier.v'))
+
+            def attribute():
+                note = self._ar.run()
+                if self._ar.attribution() is None:
+                    raise RuntimeError(
+                        f'Hierarchical synthesis failed: {self._instance_name}')
+                return note
+
+            sched.add(
+                name=f'{self._instance_name}/attr',
+                fn=attribute,
+                memory_mb=synthesis_memory_mb(self._w))
+
+        def analyze():
             args = {
                 'syn_v': syn_v,
                 'project': self._project,
                 'path': self._instance_path,
-                'frequency': frequency,
+                'frequency': self._reference_frequency,
                 'echo': self._echo,
+                'cache': self._cache,
+                'sessions': self._sessions.get('opensta'),
             }
-            orr = OpenSTARunner(**args)
-            orr.run()
-            if not self._f_min:
-                self._f_min = frequency
-            if not orr.passed():
-                break
-            self._f_max = frequency
+            if self._corners:
+                args['corners'] = self._corners
+            orr = OpenSTARunner(**args, w=self._w, activity=self._activity,
+                                power_corner=self._power_corner)
+            start = time.monotonic()
+            note = orr.run()
+            self._runtime['sta'] = time.monotonic() - start
+            self._cached['sta'] = (note == 'cached')
+            if (period := orr.min_period()) is None:
+                raise RuntimeError(f'Timing analysis failed: {self._instance_name}')
+            # f_max is that of the worst corner.
+            self._critical_path = orr.arrival()
+            f_max = 1000 / period
+            f_max_by_corner = {
+                c: 1000 / orr.min_period(c) for c in orr.corners()}
+            self._slack_by_corner = {
+                c: orr.worst_slack(c) for c in orr.corners()}
+            self._power = orr.power()
+            self._power_corner = orr.power_corner()
+            self._paths = {c: orr.path(c) for c in orr.corners()}
+            self._worst_path = orr.path()
+            self._write_paths()
+
+            if self._confirm:
+                # Re-analyze at the computed period; timing must be met at
+                # all corners.
+                args.update(frequency=f_max, period=period, tag='confirm')
+                orr = OpenSTARunner(**args)
+                orr.run()
+                if not orr.passed():
+                    raise RuntimeError(
+                        f'Timing not met at computed period ({period} ns): '
+                        f'{self._instance_name}')
+            # f_max is reported only once (where required) confirmed, such
+            # that an instance which fails confirmation is recorded as failed.
+            self._f_max = f_max
+            self._f_max_by_corner = f_max_by_corner
+            return note
+
+        sched.add(
+            name=f'{self._instance_name}/sta',
+            fn=analyze,
+            deps=[syn_job],
+            memory_mb=sta_memory_mb(self._w))
+
+    def _write_paths(self):
+        # Structured critical paths, by corner, alongside the netlist.
+        with open(self._instance_path / 'critical_path.json', 'w') as f:
+            json.dump({c: p.to_dict() for c, p in self._paths.items() if p},
+                      f, indent=1)
 
     def results(self) -> dict:
         class Result:
-            def __init__(self, sr: SynligRunner, f_max: int, f_min: int):
-                self._sr = sr
-                self._f_max = f_max
-                self._f_min = f_min
+            def __init__(self, ir: InstanceRunner):
+                self._sr = ir._sr
+                self._f_max = ir._f_max
+                self._f_max_by_corner = ir._f_max_by_corner
+                self._slack_by_corner = ir._slack_by_corner
+                self._critical_path = ir._critical_path
+                self._paths = ir._paths
+                self._worst_path = ir._worst_path
+                self._ar = ir._ar
+                self._power = ir._power
+                self._power_corner = ir._power_corner
+                self._reference_frequency = ir._reference_frequency
+                self._runtime = dict(ir._runtime)
+                self._cached = dict(ir._cached)
 
             def total_area(self) -> float:
                 return self._sr.area()[0]
@@ -267,63 +968,285 @@ class InstanceRunner:
                 ta, sa = self._sr.area()
                 return ta - sa
 
-            def f_max(self) -> int:
+            def f_max(self, corner: str = None) -> float:
+                # At a corner, otherwise the worst over all corners.
+                if corner is not None:
+                    return self._f_max_by_corner.get(corner)
                 return self._f_max
 
-            def f_min(self) -> int:
-                return self._f_min
+            def attribution(self) -> Attribution:
+                # Hierarchical area attribution, if performed.
+                return self._ar and self._ar.attribution()
+
+            def slack(self, corner: str = None) -> float:
+                # Worst slack (ns) at the reference frequency, at a corner
+                # or over all corners.
+                if corner is not None:
+                    return self._slack_by_corner.get(corner)
+                return min(self._slack_by_corner.values(), default=None)
+
+            def critical_path(self) -> float:
+                return self._critical_path
+
+            def path(self, corner: str = None) -> CriticalPath:
+                # Critical path at a corner, or at the worst corner.
+                if corner is not None:
+                    return self._paths.get(corner)
+                return self._worst_path
+
+            def runtime(self) -> dict:
+                # Elapsed time (s), by step ('syn', 'sta').
+                return self._runtime
+
+            def cached(self) -> bool:
+                # All steps were cache hits.
+                return bool(self._cached) and all(self._cached.values())
+
+            def power_corner(self) -> str:
+                # Corner at which power is estimated, if it is.
+                return self._power_corner if self._power else None
+
+            def energy(self) -> float:
+                # Dynamic (internal and switching) energy (pJ) per
+                # evaluation, as at the reference frequency.
+                if self._power is None:
+                    return None
+                internal, switching, _, _ = self._power
+                return (internal + switching) * 1e6 / self._reference_frequency
+
+            def leakage_power(self) -> float:
+                # nW
+                if self._power is None:
+                    return None
+                return self._power[2] * 1e9
+
+            def dynamic_power(self) -> float:
+                # Dynamic power (uW) when evaluating at f_max.
+                if (e := self.energy()) is None or self._f_max is None:
+                    return None
+                return e * self._f_max
 
             def __str__(self) -> str:
                 ta, sa = self._sr.area()
-                f = f'<{self._f_min}' if self._f_max is None else f'{self._f_max}'
-                return (f'{ta - sa:0.2f}, {f}')
+                if ta is None or self._f_max is None:
+                    return 'failed'
+                return (f'{ta - sa:0.2f}, {self._f_max:0.0f}')
 
-        return Result(self._sr, self._f_max, self._f_min)
+        return Result(self)
 
 class ProjectRunner:
     def __init__(self, **kwargs):
         self._project = kwargs.get('project')
-        self._frequency_sweep = kwargs.get('frequency_sweep', [])
+        self._reference_frequency = kwargs.get('reference_frequency', 1000)
+        self._confirm = kwargs.get('confirm', False)
+        self._delay_target_frequency = kwargs.get('delay_target_frequency')
+        self._retime_stages = kwargs.get('retime_stages', 0)
+        # Project parameters (in addition to W, P_ADMIT_COMPLIMENT_EN).
+        self._params = kwargs.get('params', {})
+        self._liberty = kwargs.get('liberty')
+        self._corners = kwargs.get('corners')
+        self._activity = kwargs.get('activity')
+        self._power_corner = kwargs.get('power_corner')
+        self._attribution = kwargs.get('attribution', False)
+        self._library_tag = kwargs.get('library_tag')
         self._top_level_template = kwargs.get('top_level_template')
         self._w_sweep = kwargs.get('w_sweep', [])
         self._sources = kwargs.get('sources', [])
         self._include_paths = kwargs.get('include_paths', [])
         self._echo = kwargs.get('echo', False)
-        self._results = {}
+        self._cache = kwargs.get('cache')
+        self._sessions = kwargs.get('sessions', {})
+        self._irs = {}
 
-    def run(self):
+    def submit(self, sched: Scheduler):
         for w in self._w_sweep:
-            self._results[w] = {}
             ir = InstanceRunner(
                 project=self._project,
-                frequency_sweep=self._frequency_sweep,
+                reference_frequency=self._reference_frequency,
+                confirm=self._confirm,
+                delay_target_frequency=self._delay_target_frequency,
+                retime_stages=self._retime_stages,
+                params=self._params,
+                liberty=self._liberty,
+                corners=self._corners,
+                activity=self._activity,
+                power_corner=self._power_corner,
+                attribution=self._attribution,
+                library_tag=self._library_tag,
                 w=w,
                 sources=self._sources,
                 include_paths=self._include_paths,
                 top_level_template=self._top_level_template,
                 echo=self._echo,
+                cache=self._cache,
+                sessions=self._sessions,
             )
-            ir.run()
-            self._results[w] = ir.results()
+            ir.submit(sched)
+            self._irs[w] = ir
 
     def results(self) -> list:
-        return self._results
+        return {w: ir.results() for w, ir in self._irs.items()}
+
+def run_fpga_flow(**kwargs) -> dict:
+    # Synthesis of each project and W for each FPGA family (see:
+    # FPGA_FAMILIES), by the same top-level as for ASIC synthesis.
+    sched = Scheduler(
+        jobs=kwargs.get('jobs'),
+        memory_mb=kwargs.get('memory_mb'),
+    )
+
+    cache = None
+    if cache_root := kwargs.get('cache_root'):
+        cache = ResultCache(root=cache_root)
+
+    sessions = None
+    if kwargs.get('sessions', False):
+        sessions = synlig_session_pool()
+
+    runners = {}
+    for family in kwargs.get('families', []):
+        runners[family] = {}
+        for project, sources in kwargs.get('projects', {}).items():
+            runners[family][project] = {}
+            for w in kwargs.get('w_sweep', []):
+                name = f'{instance_name(project, w)}_{family}'
+                path = pathlib.Path(name)
+                path.mkdir(exist_ok=True)
+                fr = FpgaRunner(
+                    family=family,
+                    frequency=kwargs.get('reference_frequency', 1000),
+                    project=project,
+                    path=path,
+                    w=w,
+                    sources=sources,
+                    include_paths=kwargs.get('include_paths', []),
+                    top_level_template=kwargs.get('top_level_template'),
+                    echo=kwargs.get('echo', False),
+                    cache=cache,
+                    sessions=sessions,
+                )
+
+                def synthesize(fr=fr, name=name):
+                    note = fr.run()
+                    if fr.luts() is None:
+                        raise RuntimeError(f'FPGA synthesis failed: {name}')
+                    return note
+
+                sched.add(name=f'{name}/syn', fn=synthesize,
+                          memory_mb=synthesis_memory_mb(w))
+                runners[family][project][w] = fr
+
+    try:
+        if not sched.run():
+            print('FPGA flow completed with failures.')
+    finally:
+        if sessions:
+            sessions.close()
+
+    # Runners (luts(), carries(), levels(), f_max()), by family, project
+    # and W.
+    return runners
 
 def run_synthesis_flow(**kwargs) -> int:
-    results = {}
-    for project in kwargs.get('projects', {}).keys():
-        args = {
-            'project': project,
-            'frequency_sweep': kwargs.get('frequency_sweep', []),
-            'top_level_template': kwargs.get('top_level_template'),
-            'w_sweep': kwargs.get('w_sweep', []),
-            'sources': kwargs['projects'][project],
-            'include_paths': kwargs.get('include_paths', []),
-            'echo': kwargs.get('echo', False),
-        }
+    sched = Scheduler(
+        jobs=kwargs.get('jobs'),
+        memory_mb=kwargs.get('memory_mb'),
+    )
+
+    cache = None
+    if cache_root := kwargs.get('cache_root'):
+        cache = ResultCache(root=cache_root)
+
+    # Standard-cell libraries (by name, see: cfg.STDCELL_LIBS); instances
+    # of all but the first are distinguished by the library name.
+    from cfg import STDCELL_LIBS
+    libraries = kwargs.get('libraries') or list(STDCELL_LIBS.keys())[:1]
+
+    # Area-driven synthesis, timing-driven synthesis at each target, and
+    # area-driven synthesis with each number of retiming stages, of
+    # (explicit) pipeline stages, with each carry architecture and with
+    # one-hot detection by reduction tree; by their synthesis options.
+    modes = {'area': {}}
+    for f in kwargs.get('delay_target_frequencies', []):
+        modes[f'delay@{f}MHz'] = {'delay_target_frequency': f}
+    for n in kwargs.get('retime_stages', []):
+        modes[f'retime@{n}'] = {'retime_stages': n}
+    for n in kwargs.get('pipe_stages', []):
+        modes[f'pipe@{n}'] = {'params': {'P_PIPE_STAGES': n}}
+    # Carry architectures, of the incrementer-based projects only.
+    from projects import ADDER_ARCHS, ADDER_ARCH_PROJECTS
+    for arch in kwargs.get('adder_archs', []):
+        modes[f'arch@{arch}'] = {'params': {'P_ADDER_ARCH': ADDER_ARCHS[arch]},
+                                 'projects': ADDER_ARCH_PROJECTS}
+    # Of e and p only, over its own (wider) W sweep.
+    from projects import ONE_HOT_TREE_PROJECTS
+    if tree_w_sweep := kwargs.get('one_hot_tree_w_sweep'):
+        modes['tree'] = {'params': {'P_1HOT_TREE_EN': 1},
+                         'projects': ONE_HOT_TREE_PROJECTS,
+                         'w_sweep': tree_w_sweep}
+
+    pools = []
+    synlig_sessions = None
+    if kwargs.get('sessions', False):
+        synlig_sessions = synlig_session_pool()
+        pools.append(synlig_sessions)
+
+    prs = {}
+    for i, library in enumerate(libraries):
+        lib = STDCELL_LIBS[library]
+
+        sessions = {}
+        if synlig_sessions:
+            sessions = {
+                'synlig': synlig_sessions,
+                'opensta': opensta_session_pool(lib['corners']),
+            }
+            pools.append(sessions['opensta'])
+
+        prs[library] = {}
+        for mode, options in modes.items():
+            prs[library][mode] = {}
+            for project in kwargs.get('projects', {}).keys():
+                if project not in options.get('projects', [project]):
+                    continue
+                args = {
+                    'project': project,
+                    'reference_frequency': kwargs.get('reference_frequency', 1000),
+                    'confirm': kwargs.get('confirm_f_max', False),
+                    'delay_target_frequency': options.get('delay_target_frequency'),
+                    'retime_stages': options.get('retime_stages', 0),
+                    'params': options.get('params', {}),
+                    'liberty': lib['synthesis'],
+                    'corners': lib['corners'],
+                    'activity': kwargs.get('activity'),
+                    'power_corner': lib.get('power_corner'),
+                    # Of area-driven synthesis only.
+                    'attribution': kwargs.get('area_attribution', False)
+                                   and mode == 'area',
+                    'library_tag': library if i != 0 else None,
+                    'top_level_template': kwargs.get('top_level_template'),
+                    'w_sweep': options.get('w_sweep', kwargs.get('w_sweep', [])),
+                    'sources': kwargs['projects'][project],
+                    'include_paths': kwargs.get('include_paths', []),
+                    'echo': kwargs.get('echo', False),
+                    'cache': cache,
+                    'sessions': sessions,
+                }
+
+                pr = ProjectRunner(**args)
+                pr.submit(sched)
+                prs[library][mode][project] = pr
 
-        r = ProjectRunner(**args)
-        r.run()
-        results[project] = r.results()
+    try:
+        if not sched.run():
+            print('Synthesis flow completed with failures.')
+    finally:
+        for pool in pools:
+            pool.close()
 
-    return results
+    # Results, by library, mode ('area', 'delay@<f>MHz', 'retime@<n>',
+    # 'pipe@<n>', 'arch@<name>' or 'tree'), project and W.
+    return {library: {mode: {project: pr.results()
+                             for project, pr in ps.items()}
+                      for mode, ps in ms.items()}
+            for library, ms in prs.items()}
@@ -0,0 +1,97 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "activity.h"
+
+#include <fstream>
+#include <iomanip>
+
+namespace tb {
+
+void Activity::record(const StimulusVector& v) noexcept {
+  const StimulusVector& prior{prior_};
+  for (std::size_t i = 0; i < cfg::W; i++) {
+    const bool b = v.bit(i);
+    if ((n_ != 0) && (b != prior.bit(i))) {
+      ++toggles_[i];
+    }
+    if (b) {
+      ++ones_[i];
+    }
+  }
+  prior_ = v;
+  ++n_;
+}
+
+bool Activity::write(const std::string& fn, std::string& error) const {
+  if (n_ < 2) {
+    error = "Insufficient stimulus to compute activity.";
+    return false;
+  }
+
+  std::ofstream os{fn};
+  if (!os) {
+    error = "Unable to open activity file: " + fn;
+    return false;
+  }
+
+  // Activity is in transitions per clock cycle; duty is the fraction of
+  // cycles at which the signal is high.
+  auto activity = [&](std::size_t i) {
+    return static_cast<double>(toggles_[i]) / (n_ - 1);
+  };
+  auto duty = [&](std::size_t i) {
+    return static_cast<double>(ones_[i]) / n_;
+  };
+
+  double activity_sum = 0.0, duty_sum = 0.0;
+  for (std::size_t i = 0; i < cfg::W; i++) {
+    activity_sum += activity(i);
+    duty_sum += duty(i);
+  }
+
+  os << std::fixed << std::setprecision(6);
+  os << "# Switching activity: " << n_ << " vectors, W=" << cfg::W << "\n";
+  // Mean over all bits; applies to instances of any width.
+  os << "set_power_activity -input -activity " << (activity_sum / cfg::W)
+     << " -duty " << (duty_sum / cfg::W) << "\n";
+  // Per-bit, where the instance is of the same width ('u_w').
+  os << "if {[info exists u_w] && $u_w == " << cfg::W << "} {\n";
+  for (std::size_t i = 0; i < cfg::W; i++) {
+    os << "  set_power_activity -input_ports [get_ports {i_x[" << i
+       << "]}] -activity " << activity(i) << " -duty " << duty(i) << "\n";
+  }
+  os << "}\n";
+
+  if (!os.good()) {
+    error = "Unable to write activity file: " + fn;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tb
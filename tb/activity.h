@@ -0,0 +1,59 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_ACTIVITY_H
+#define TB_ACTIVITY_H
+
+#include <array>
+#include <string>
+
+#include "cfg.h"
+#include "stimulus.h"
+
+namespace tb {
+
+// Switching activity of the stimulus presented to designs, per input bit,
+// for estimation of dynamic power. Vectors are assumed to be presented on
+// consecutive cycles.
+inline class Activity {
+ public:
+  void record(const StimulusVector& v) noexcept;
+
+  // Write activity as OpenSTA commands (set_power_activity) on the ports of
+  // the synthesis top-level.
+  bool write(const std::string& fn, std::string& error) const;
+
+ private:
+  std::size_t n_ = 0;
+  std::array<std::size_t, cfg::W> toggles_{};
+  std::array<std::size_t, cfg::W> ones_{};
+  StimulusVector prior_;
+} ACTIVITY;
+
+}  // namespace tb
+
+#endif
@@ -0,0 +1,135 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "batch.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "cfg.h"
+#include "common.h"
+#include "designs.h"
+#include "stimulus.h"
+
+namespace tb {
+
+namespace {
+
+// Unpack row 'i' of a packed batch into a stimulus vector. Packed words are
+// LSB-first, therefore (on a little-endian host) the byte image of a row is
+// identical to that of the stimulus vector.
+StimulusVector unpack(const vluint64_t* x, std::size_t i) {
+  const vluint8_t* row =
+      reinterpret_cast<const vluint8_t*>(x + i * batch_stride());
+  StimulusVector v{row, StimulusVector::size_bytes_n()};
+  v.clean();
+  return v;
+}
+
+std::size_t resolve_threads(std::size_t threads_n, std::size_t n) {
+  if (threads_n == 0) {
+    threads_n = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::max<std::size_t>(1, std::min(threads_n, n));
+}
+
+// Partition [0, n) into 'threads_n' contiguous ranges and invoke 'f' on each
+// range from a dedicated thread.
+template <typename F>
+void parallel_for(std::size_t n, std::size_t threads_n, F&& f) {
+  const std::size_t chunk_n = ceil(n, threads_n);
+  std::vector<std::thread> ts;
+  for (std::size_t t = 0; t < threads_n; t++) {
+    const std::size_t begin = std::min(n, t * chunk_n);
+    const std::size_t end = std::min(n, begin + chunk_n);
+    ts.emplace_back([&f, t, begin, end]() { f(t, begin, end); });
+  }
+  for (std::thread& t : ts) {
+    t.join();
+  }
+}
+
+}  // namespace
+
+std::size_t batch_stride() noexcept { return ceil(cfg::W, 64); }
+
+bool evaluate_batch(const std::string& name, const vluint64_t* x,
+                    std::size_t n, bool* is_unary, bool* is_compliment,
+                    std::size_t threads_n) {
+  threads_n = resolve_threads(threads_n, n);
+
+  // Construct one design instance per worker up-front; the registry is not
+  // otherwise safe to access concurrently.
+  std::vector<std::unique_ptr<DesignBase> > ds;
+  for (std::size_t t = 0; t < threads_n; t++) {
+    std::unique_ptr<DesignBase> d = DESIGN_REGISTRY.construct_design(name);
+    if (!d) {
+      return false;
+    }
+    ds.push_back(std::move(d));
+  }
+
+  // Vectors are streamed, such that pipelined designs are evaluated at full
+  // throughput.
+  constexpr std::size_t block_n = 1024;
+  parallel_for(
+      n, threads_n, [&](std::size_t t, std::size_t begin, std::size_t end) {
+        std::vector<StimulusVector> vs;
+        for (std::size_t i = begin; i < end; i += block_n) {
+          vs.clear();
+          for (std::size_t j = i; j < std::min(end, i + block_n); j++) {
+            vs.push_back(unpack(x, j));
+          }
+          const std::vector<std::tuple<bool, bool> > rs{
+              ds[t]->is_unary_stream(vs)};
+          for (std::size_t j = 0; j < vs.size(); j++) {
+            // Vectors without response (deadlock) are rejected.
+            std::tie(is_unary[i + j], is_compliment[i + j]) =
+                (j < rs.size()) ? rs[j] : std::tuple<bool, bool>{false, false};
+          }
+        }
+      });
+  return true;
+}
+
+void evaluate_batch_golden(const vluint64_t* x, std::size_t n, bool* is_unary,
+                           bool* is_compliment, std::size_t threads_n) {
+  parallel_for(n, resolve_threads(threads_n, n),
+               [&](std::size_t, std::size_t begin, std::size_t end) {
+                 for (std::size_t i = begin; i < end; i++) {
+                   auto [u, c] = tb::is_unary(unpack(x, i));
+                   is_unary[i] = u;
+                   // Compliment is only flagged by RTL when admitted.
+                   is_compliment[i] = (cfg::ADMIT_COMPLIMENT && c);
+                 }
+               });
+}
+
+}  // namespace tb
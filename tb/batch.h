@@ -0,0 +1,57 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_BATCH_H
+#define TB_BATCH_H
+
+#include <cstddef>
+#include <string>
+
+#include "vsupport.h"
+
+namespace tb {
+
+// Number of 64b words occupied by a single packed stimulus vector.
+std::size_t batch_stride() noexcept;
+
+// Evaluate 'n' stimulus vectors on design 'name'. Vectors are packed as
+// consecutive rows of batch_stride() 64b words, LSB-first, and are read in
+// place. Work is partitioned across 'threads_n' workers (0 selects the
+// hardware concurrency), each of which owns an independent instance of the
+// design. Returns false if 'name' is not a registered design.
+bool evaluate_batch(const std::string& name, const vluint64_t* x,
+                    std::size_t n, bool* is_unary, bool* is_compliment,
+                    std::size_t threads_n = 0);
+
+// As above, but evaluated against the behavioral model. Outputs are reported
+// as the RTL would present them.
+void evaluate_batch_golden(const vluint64_t* x, std::size_t n, bool* is_unary,
+                           bool* is_compliment, std::size_t threads_n = 0);
+
+}  // namespace tb
+
+#endif
@@ -39,6 +39,11 @@
 #define U_MACRO_END     } while (false)
 // clang-format on
 
+// Default visibility, for state which design plugins resolve against the
+// testbench (see: plugins.cc), irrespective of the visibility with which the
+// including target is compiled.
+#define U_EXPORT __attribute__((visibility("default")))
+
 namespace tb {
 
 constexpr std::size_t ceil(std::size_t n, std::size_t d) {
@@ -25,10 +25,9 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //========================================================================== //
 
-#include <sstream>
-
 #include "designs.h"
-#include "verilated_vcd_c.h"
+
+#include "vdesign.h"
 
 namespace tb {
 
@@ -45,113 +44,11 @@ std::unique_ptr<DesignBase> DesignRegistry::construct_design(
   return construct_design(std::string{name});
 }
 
-template <typename T>
-concept VUnaryModule = requires(T t) {
-  { t.eval() } -> std::same_as<void>;
-  t.i_x;
-  t.o_is_unary;
-  t.o_is_compliment;
-};
-
-template <VUnaryModule T>
-class Design : public DesignBase {
- public:
-  explicit Design(const std::string& name) : DesignBase(name) {
-    ctxt_ = std::make_unique<VerilatedContext>();
-    if constexpr (T::traceCapable) {
-      ctxt_->traceEverOn(OPTIONS.vcd_en);
-    }
-    uut_ = std::make_unique<T>(ctxt_.get(), name.c_str());
-    if constexpr (T::traceCapable) {
-      construct_trace();
-    }
-  }
-
-  ~Design() {
-    if constexpr (T::traceCapable) {
-      destruct_trace();
-
-    }
-  }
-
-  std::tuple<bool, bool> is_unary(const StimulusVector& v) noexcept override {
-    // Drive input
-    v.to_verilated(uut_->i_x);
-    // Advance simulator
-    step();
-    // Return response.
-    return {VBit::from_verilated(uut_->o_is_unary).to_bool(),
-            VBit::from_verilated(uut_->o_is_compliment).to_bool()};
-  }
-
- private:
-  void step(std::size_t n = 1) {
-    while (n--) {
-      // Advance time
-      ctxt_->timeInc(1);
-      // Evaluate
-      uut_->eval();
-
-      if constexpr (T::traceCapable) {
-        if (OPTIONS.vcd_en) {
-          vcd_->dump(ctxt_->time());
-        }
-      }
-    }
-  }
-  void construct_trace() {
-    if (!OPTIONS.vcd_en) {
-      return;
-    }
-
-    vcd_ = std::make_unique<VerilatedVcdC>();
-    uut_->trace(vcd_.get(), 99);
-    std::ostringstream ss;
-    ss << name() << ".vcd";
-    vcd_->open(ss.str().c_str());
-  }
-
-  void destruct_trace() {
-    if (!vcd_) {
-      return;
-    }
-
-    // Append some sort rundown period at end-of-simulation to
-    // emit final parts of trace.
-    step(2);
-  
-    vcd_->close();
-  }
-
-  std::unique_ptr<VerilatedContext> ctxt_;
-  std::unique_ptr<VerilatedVcdC> vcd_;
-  std::unique_ptr<T> uut_;
-};
-
-template <typename T>
-class DesignBuilder : public tb::DesignRegistry::DesignBuilderBase {
- public:
-  explicit DesignBuilder(const std::string& name) : name_(name) {}
-  std::unique_ptr<DesignBase> construct() const override {
-    return std::unique_ptr<DesignBase>(new Design<T>(name_));
-  }
-
- private:
-  std::string name_;
-};
-
 }  // namespace tb
 
-// clang-format off
-#define DECLARE_DESIGN(__name)                            \
-  static const struct DesignRegister##__name {            \
-    explicit DesignRegister##__name() {                   \
-      auto b = std::unique_ptr<tb::DesignRegistry::DesignBuilderBase>(\
-        new tb::DesignBuilder<V##__name>(#__name)); \
-      tb::DESIGN_REGISTRY.add(#__name, std::move(b)); \
-    }                                                     \
-  } __register_##__name {}
-// clang-format on
+// Designs are otherwise loaded at start-up from shared-object plugins (see:
+// plugins.h).
+#ifndef U_TB_DESIGN_PLUGINS
 
 #include "VObj_u/Vu.h"
 DECLARE_DESIGN(u);
@@ -168,4 +65,28 @@ DECLARE_DESIGN(c);
 #include "VObj_o/Vo.h"
 DECLARE_DESIGN(o);
 
+#include "VObj_e_tree/Ve_tree.h"
+DECLARE_DESIGN(e_tree);
+
+#include "VObj_p_tree/Vp_tree.h"
+DECLARE_DESIGN(p_tree);
+
+#include "VObj_o_reg/Vo_reg.h"
+DECLARE_CLOCKED_DESIGN(o_reg, 2);
+
+#include "VObj_unary_detect/Vunary_detect.h"
+DECLARE_DESIGN(unary_detect);
+
+#include "VObj_unary_detect_fastest/Vunary_detect_fastest.h"
+DECLARE_DESIGN(unary_detect_fastest);
+
+#include "pipe_designs.h"
+
+#include "arch_designs.h"
+
+#include "netlist_designs.h"
+
 #undef DECLARE_DESIGN
+#undef DECLARE_CLOCKED_DESIGN
+
+#endif
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -50,9 +51,30 @@ class DesignBase {
   // decision.
   virtual std::tuple<bool, bool> is_unary(const StimulusVector& v) noexcept = 0;
 
+  // Evaluate verilated module with a stream of stimulus, presenting (where
+  // the module is pipelined) a new vector on each cycle, and return the
+  // admission decision for each vector in order.
+  virtual std::vector<std::tuple<bool, bool> > is_unary_stream(
+      const std::vector<StimulusVector>& vs) noexcept {
+    std::vector<std::tuple<bool, bool> > rs;
+    rs.reserve(vs.size());
+    for (const StimulusVector& v : vs) {
+      rs.push_back(is_unary(v));
+    }
+    return rs;
+  }
+
+  // Probability, on each cycle of a stream, that the response presented by
+  // a stallable design (one with an 'i_ready' input) is not accepted, such
+  // that the design must hold it, and stall, until it is.
+  void set_stall_probability(float p) noexcept { stall_prob_ = p; }
+  float stall_probability() const noexcept { return stall_prob_; }
+
  private:
   // Design name.
   std::string name_;
+  // Response stall probability (0: responses always accepted).
+  float stall_prob_ = 0.0f;
 };
 
 inline class DesignRegistry {
@@ -0,0 +1,177 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+// Coverage-guided fuzz target (libFuzzer, or AFL in persistent mode). Each
+// input is sliced into consecutive stimulus vectors (the final vector being
+// zero-extended), which are applied to every registered design and checked
+// against the behavioral model. A mismatch aborts, such that the input is
+// retained by the fuzzer as a crash.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cfg.h"
+#include "designs.h"
+#include "plugins.h"
+#include "stimulus.h"
+
+namespace {
+
+std::vector<std::unique_ptr<tb::DesignBase> > DESIGNS;
+
+void construct_designs() {
+  if (tb::cfg::DESIGN_PLUGINS) {
+    std::string error;
+    if (!tb::load_plugin_dir(tb::cfg::PLUGIN_DIR, error)) {
+      std::cerr << "Failed to load design plugins: " << error << "\n";
+      std::exit(1);
+    }
+  }
+
+  std::vector<std::string> names;
+  tb::DESIGN_REGISTRY.designs(std::back_inserter(names));
+  for (const std::string& name : names) {
+    DESIGNS.push_back(tb::DESIGN_REGISTRY.construct_design(name));
+  }
+}
+
+// Equivalent to TestCase::check, less logging.
+bool matches(bool rtl_is_unary, bool rtl_is_compliment, bool beh_is_unary,
+             bool beh_is_compliment) {
+  if (rtl_is_unary != beh_is_unary) {
+    return false;
+  }
+  if (tb::cfg::ADMIT_COMPLIMENT) {
+    return (rtl_is_compliment == beh_is_compliment);
+  }
+  return !rtl_is_compliment;
+}
+
+void check(const tb::StimulusVector& v) {
+  auto [beh_is_unary, beh_is_compliment] = tb::is_unary(v);
+  for (std::unique_ptr<tb::DesignBase>& d : DESIGNS) {
+    auto [rtl_is_unary, rtl_is_compliment] = d->is_unary(v);
+    if (!matches(rtl_is_unary, rtl_is_compliment, beh_is_unary,
+                 beh_is_compliment)) {
+      std::cerr << "Mismatch on design " << d->name() << ": x=";
+      v.render_to(std::cerr);
+      std::cerr << " rtl_is_unary=" << rtl_is_unary
+                << " rtl_is_compliment=" << rtl_is_compliment
+                << " beh_is_unary=" << beh_is_unary
+                << " beh_is_compliment=" << beh_is_compliment << "\n";
+      std::abort();
+    }
+  }
+}
+
+void write_vector(const std::filesystem::path& p, const tb::StimulusVector& v) {
+  std::vector<char> bytes(tb::StimulusVector::size_bytes_n(), 0);
+  for (std::size_t i = 0; i < v.size(); i++) {
+    if (v.bit(i)) {
+      bytes[i >> 3] |= static_cast<char>(1 << (i & 0x7));
+    }
+  }
+  std::ofstream os{p, std::ios::binary};
+  os.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Seed corpus: every valid code, and its neighbours at distance one about
+// the encoding boundary (where detectors are most likely to be incorrect).
+void write_seed_corpus(const std::filesystem::path& dir) {
+  std::filesystem::create_directories(dir);
+  for (const bool compliment : {false, true}) {
+    if (compliment && !tb::cfg::ADMIT_COMPLIMENT) {
+      continue;
+    }
+    for (std::size_t n = 0; n <= tb::cfg::W; n++) {
+      const std::string stem{"u" + std::to_string(n) +
+                             (compliment ? "c" : "")};
+      const tb::StimulusVector v{tb::generate_unary(n, compliment)};
+      write_vector(dir / stem, v);
+
+      for (std::size_t i = (n < 2) ? 0 : n - 2;
+           i < std::min(n + 2, tb::cfg::W); i++) {
+        tb::StimulusVector neighbour{v};
+        neighbour.bit(i, !v.bit(i));
+        write_vector(dir / (stem + "_f" + std::to_string(i)), neighbour);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv) {
+  constexpr std::string_view seed_corpus_arg{"--seed_corpus="};
+  for (int i = 1; i < *argc; i++) {
+    const std::string_view arg{(*argv)[i]};
+    if (arg.starts_with(seed_corpus_arg)) {
+      write_seed_corpus(arg.substr(seed_corpus_arg.size()));
+      std::exit(0);
+    }
+  }
+
+  construct_designs();
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data,
+                                      std::size_t size) {
+  const std::size_t n = tb::StimulusVector::size_bytes_n();
+  for (std::size_t i = 0; i < size; i += n) {
+    tb::StimulusVector v{data + i, size - i};
+    v.clean();
+    check(v);
+  }
+  return 0;
+}
+
+#ifdef U_TB_FUZZ_AFL
+
+__AFL_FUZZ_INIT();
+
+int main(int argc, char** argv) {
+  LLVMFuzzerInitialize(&argc, &argv);
+  __AFL_INIT();
+
+  const unsigned char* buf = __AFL_FUZZ_TESTCASE_BUF;
+  while (__AFL_LOOP(100000)) {
+    LLVMFuzzerTestOneInput(buf, __AFL_FUZZ_TESTCASE_LEN);
+  }
+  return 0;
+}
+
+#endif
@@ -0,0 +1,527 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "liberty.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+namespace tb {
+
+namespace {
+
+// Compiler of Liberty function expressions. Precedence is (highest first):
+// inversion ('!' prefix, '\'' postfix), XOR ('^'), AND ('&', '*' or
+// juxtaposition), then OR ('|', '+').
+class FunctionCompiler {
+ public:
+  explicit FunctionCompiler(std::string_view s,
+                            const std::vector<std::string>& operands,
+                            LogicFunction& f)
+      : s_(s), operands_(operands), f_(f) {}
+
+  bool compile(std::string& error) {
+    f_ = LogicFunction{};
+    depth_n_ = 0;
+    if (!or_expr(error)) {
+      return false;
+    }
+    skip_ws();
+    if (i_ != s_.size()) {
+      return fail(error, "unexpected character");
+    }
+    return true;
+  }
+
+ private:
+  bool or_expr(std::string& error) {
+    if (!and_expr(error)) return false;
+    while (peek() == '|' || peek() == '+') {
+      ++i_;
+      if (!and_expr(error)) return false;
+      emit(LogicOp::Or);
+    }
+    return true;
+  }
+
+  bool and_expr(std::string& error) {
+    if (!xor_expr(error)) return false;
+    while (true) {
+      const char c = peek();
+      if (c == '&' || c == '*') {
+        ++i_;
+      } else if (!is_primary(c)) {
+        break;
+      }
+      // Otherwise, juxtaposition.
+      if (!xor_expr(error)) return false;
+      emit(LogicOp::And);
+    }
+    return true;
+  }
+
+  bool xor_expr(std::string& error) {
+    if (!unary_expr(error)) return false;
+    while (peek() == '^') {
+      ++i_;
+      if (!unary_expr(error)) return false;
+      emit(LogicOp::Xor);
+    }
+    return true;
+  }
+
+  bool unary_expr(std::string& error) {
+    if (peek() == '!') {
+      ++i_;
+      if (!unary_expr(error)) return false;
+      emit(LogicOp::Not);
+    } else if (!primary(error)) {
+      return false;
+    }
+    while (peek() == '\'') {
+      ++i_;
+      emit(LogicOp::Not);
+    }
+    return true;
+  }
+
+  bool primary(std::string& error) {
+    const char c = peek();
+    if (c == '(') {
+      ++i_;
+      if (!or_expr(error)) return false;
+      if (peek() != ')') {
+        return fail(error, "expected ')'");
+      }
+      ++i_;
+      return true;
+    }
+    if (!is_identifier(c)) {
+      return fail(error, "expected operand");
+    }
+    const std::size_t begin = i_;
+    while (i_ < s_.size() && is_identifier(s_[i_])) {
+      ++i_;
+    }
+    const std::string_view id{s_.substr(begin, i_ - begin)};
+    if (id == "0") {
+      emit(LogicOp::Zero);
+    } else if (id == "1") {
+      emit(LogicOp::One);
+    } else {
+      auto it = std::find(operands_.begin(), operands_.end(), id);
+      if (it == operands_.end()) {
+        return fail(error, "unknown operand '" + std::string{id} + "'");
+      }
+      emit(LogicOp::Load,
+           static_cast<std::uint32_t>(std::distance(operands_.begin(), it)));
+    }
+    return true;
+  }
+
+  void emit(LogicOp op, std::uint32_t arg = 0) {
+    switch (op) {
+      case LogicOp::Load:
+      case LogicOp::Zero:
+      case LogicOp::One:
+        f_.depth_n = std::max(f_.depth_n, ++depth_n_);
+        break;
+      case LogicOp::And:
+      case LogicOp::Or:
+      case LogicOp::Xor:
+        --depth_n_;
+        break;
+      default:
+        break;
+    }
+    f_.code.push_back(LogicInstr{op, arg});
+  }
+
+  char peek() {
+    skip_ws();
+    return (i_ < s_.size()) ? s_[i_] : '\0';
+  }
+
+  void skip_ws() {
+    while (i_ < s_.size() && std::isspace(static_cast<unsigned char>(s_[i_]))) {
+      ++i_;
+    }
+  }
+
+  static bool is_identifier(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' ||
+           c == '[' || c == ']' || c == '.';
+  }
+
+  static bool is_primary(char c) {
+    return is_identifier(c) || c == '(' || c == '!';
+  }
+
+  bool fail(std::string& error, const std::string& msg) {
+    error = msg + " at offset " + std::to_string(i_) + " in \"" +
+            std::string{s_} + "\"";
+    return false;
+  }
+
+  std::string_view s_;
+  std::size_t i_ = 0;
+  const std::vector<std::string>& operands_;
+  LogicFunction& f_;
+  std::size_t depth_n_ = 0;
+};
+
+// Liberty group (retaining only the attributes and sub-groups required to
+// recover cell functions).
+struct Group {
+  std::string type;
+  std::vector<std::string> args;
+  std::vector<std::pair<std::string, std::string> > attrs;
+  std::vector<Group> groups;
+
+  const std::string* attr(std::string_view name) const {
+    for (const auto& [k, v] : attrs) {
+      if (k == name) return std::addressof(v);
+    }
+    return nullptr;
+  }
+};
+
+bool is_retained_group(std::string_view type) {
+  return type == "library" || type == "cell" || type == "pin" ||
+         type == "ff" || type == "latch" || type == "statetable" ||
+         type == "ff_bank" || type == "latch_bank";
+}
+
+bool is_retained_attr(std::string_view name) {
+  return name == "direction" || name == "function" || name == "clocked_on" ||
+         name == "next_state" || name == "clear" || name == "preset";
+}
+
+class LibertyParser {
+  enum class Kind { Word, Punct, End };
+
+  struct Token {
+    Kind kind;
+    std::string_view text;
+
+    bool is(char c) const {
+      return (kind == Kind::Punct) && (text.front() == c);
+    }
+  };
+
+ public:
+  explicit LibertyParser(std::string_view s) : s_(s) {}
+
+  bool parse(Group& root, std::string& error) {
+    while (peek().kind != Kind::End) {
+      if (!statement(&root, error)) return false;
+    }
+    return true;
+  }
+
+ private:
+  // Parse a single statement (attribute or group) into 'g'; content is
+  // discarded when 'g' is null.
+  bool statement(Group* g, std::string& error) {
+    const Token name = next();
+    if (name.kind != Kind::Word) {
+      return fail(error, "expected identifier");
+    }
+
+    const Token t = next();
+    if (t.is(':')) {
+      // Simple attribute
+      const Token v = next();
+      if (v.kind != Kind::Word) {
+        return fail(error, "expected attribute value");
+      }
+      if (g && is_retained_attr(name.text)) {
+        g->attrs.emplace_back(name.text, v.text);
+      }
+      // Discard any remainder (for example, arithmetic expressions).
+      while (!peek().is(';') && !peek().is('}') && peek().kind != Kind::End) {
+        next();
+      }
+      if (peek().is(';')) next();
+      return true;
+    }
+
+    if (!t.is('(')) {
+      return fail(error, "expected ':' or '('");
+    }
+
+    std::vector<std::string_view> args;
+    for (Token a = next(); !a.is(')'); a = next()) {
+      if (a.kind == Kind::End) {
+        return fail(error, "unterminated argument list");
+      }
+      if (a.kind == Kind::Word) {
+        args.push_back(a.text);
+      }
+    }
+
+    if (peek().is('{')) {
+      // Group
+      next();
+      Group* child = nullptr;
+      if (g && is_retained_group(name.text)) {
+        child = std::addressof(g->groups.emplace_back());
+        child->type = name.text;
+        child->args.assign(args.begin(), args.end());
+      }
+      while (!peek().is('}')) {
+        if (peek().kind == Kind::End) {
+          return fail(error, "unterminated group");
+        }
+        if (!statement(child, error)) return false;
+      }
+      next();
+    } else if (peek().is(';')) {
+      // Complex attribute (discarded).
+      next();
+    }
+    return true;
+  }
+
+  Token peek() {
+    if (!peeked_) {
+      token_ = lex();
+      peeked_ = true;
+    }
+    return token_;
+  }
+
+  Token next() {
+    const Token t = peek();
+    peeked_ = false;
+    return t;
+  }
+
+  Token lex() {
+    skip_ws_and_comments();
+    if (i_ >= s_.size()) {
+      return Token{Kind::End, {}};
+    }
+
+    const char c = s_[i_];
+    if (c == '"') {
+      const std::size_t begin = ++i_;
+      while (i_ < s_.size() && s_[i_] != '"') {
+        if (s_[i_] == '\n') ++line_;
+        i_ += (s_[i_] == '\\') ? 2 : 1;
+      }
+      const std::string_view text{s_.substr(begin, i_ - begin)};
+      ++i_;
+      return Token{Kind::Word, text};
+    }
+    if (is_punct(c)) {
+      return Token{Kind::Punct, s_.substr(i_++, 1)};
+    }
+    const std::size_t begin = i_;
+    while (i_ < s_.size() && !is_punct(s_[i_]) && s_[i_] != '"' &&
+           !std::isspace(static_cast<unsigned char>(s_[i_]))) {
+      ++i_;
+    }
+    return Token{Kind::Word, s_.substr(begin, i_ - begin)};
+  }
+
+  void skip_ws_and_comments() {
+    while (i_ < s_.size()) {
+      const char c = s_[i_];
+      if (c == '\n') {
+        ++line_;
+        ++i_;
+      } else if (std::isspace(static_cast<unsigned char>(c))) {
+        ++i_;
+      } else if (c == '\\' && (i_ + 1) < s_.size() &&
+                 (s_[i_ + 1] == '\n' || s_[i_ + 1] == '\r')) {
+        // Line continuation
+        ++i_;
+      } else if (s_.substr(i_, 2) == "/*") {
+        const std::size_t end = s_.find("*/", i_ + 2);
+        const std::size_t stop = (end == std::string_view::npos) ? s_.size()
+                                                                 : end + 2;
+        line_ += std::count(s_.begin() + i_, s_.begin() + stop, '\n');
+        i_ = stop;
+      } else {
+        break;
+      }
+    }
+  }
+
+  static bool is_punct(char c) {
+    return c == '(' || c == ')' || c == '{' || c == '}' || c == ':' ||
+           c == ';' || c == ',';
+  }
+
+  bool fail(std::string& error, const std::string& msg) {
+    error = msg + " on line " + std::to_string(line_);
+    return false;
+  }
+
+  std::string_view s_;
+  std::size_t i_ = 0;
+  std::size_t line_ = 1;
+  bool peeked_ = false;
+  Token token_;
+};
+
+// Recover function of cell from its group. Returns false if the cell is
+// not supported.
+bool build_cell(const Group& g, LibertyCell& c, std::string& error) {
+  c.name = g.args.empty() ? std::string{} : g.args.front();
+
+  // Operands: input pins, then state variables.
+  for (const Group& pin : g.groups) {
+    const std::string* dir = pin.attr("direction");
+    if (pin.type == "pin" && dir && (*dir == "input") && !pin.args.empty()) {
+      c.operands.push_back(pin.args.front());
+    }
+  }
+  c.inputs_n = c.operands.size();
+
+  const Group* ff = nullptr;
+  for (const Group& s : g.groups) {
+    if (s.type == "ff") {
+      ff = std::addressof(s);
+    } else if (s.type != "pin") {
+      error = "unsupported '" + s.type + "' group";
+      return false;
+    }
+  }
+
+  if (ff) {
+    if (ff->args.size() != 2) {
+      error = "malformed 'ff' group";
+      return false;
+    }
+    c.is_ff = true;
+
+    // Only flops clocked on the rising edge of a pin are modelled; those on
+    // a falling edge, or on a function of several pins (for example, an
+    // integrated clock gate), are not.
+    const std::string* clocked_on = ff->attr("clocked_on");
+    if (!clocked_on) {
+      error = "'ff' group has no clocked_on";
+      return false;
+    }
+    auto clock = std::find(c.operands.begin(), c.operands.end(), *clocked_on);
+    if (clock == c.operands.end()) {
+      error = "unsupported clocked_on \"" + *clocked_on + "\"";
+      return false;
+    }
+    c.clock = std::distance(c.operands.begin(), clock);
+
+    c.operands.push_back(ff->args[0]);
+    c.operands.push_back(ff->args[1]);
+
+    const std::string* next_state = ff->attr("next_state");
+    if (!next_state) {
+      error = "'ff' group has no next_state";
+      return false;
+    }
+    if (!compile_function(*next_state, c.operands, c.next_state, error)) {
+      return false;
+    }
+    if (const std::string* clear = ff->attr("clear");
+        clear && !compile_function(*clear, c.operands, c.clear, error)) {
+      return false;
+    }
+    if (const std::string* preset = ff->attr("preset");
+        preset && !compile_function(*preset, c.operands, c.preset, error)) {
+      return false;
+    }
+  }
+
+  for (const Group& pin : g.groups) {
+    const std::string* dir = pin.attr("direction");
+    const std::string* function = pin.attr("function");
+    if (pin.type != "pin" || !dir || (*dir != "output") || !function ||
+        pin.args.empty()) {
+      continue;
+    }
+    LogicFunction f;
+    if (!compile_function(*function, c.operands, f, error)) {
+      error = "pin " + pin.args.front() + ": " + error;
+      return false;
+    }
+    c.outputs.emplace_back(pin.args.front(), std::move(f));
+  }
+  return true;
+}
+
+}  // namespace
+
+bool compile_function(std::string_view expr,
+                      const std::vector<std::string>& operands,
+                      LogicFunction& f, std::string& error) {
+  return FunctionCompiler{expr, operands, f}.compile(error);
+}
+
+bool Liberty::load(const std::string& fn, std::string& error) {
+  std::ifstream is{fn};
+  if (!is) {
+    error = "unable to open " + fn;
+    return false;
+  }
+  std::ostringstream ss;
+  ss << is.rdbuf();
+  const std::string s{ss.str()};
+
+  Group root;
+  if (!LibertyParser{s}.parse(root, error)) {
+    error = fn + ": " + error;
+    return false;
+  }
+
+  for (const Group& library : root.groups) {
+    for (const Group& g : library.groups) {
+      if (g.type != "cell") continue;
+
+      // Cells which cannot be modelled are retained, such that their use
+      // in a netlist may be diagnosed.
+      LibertyCell c;
+      std::string cell_error;
+      if (!build_cell(g, c, cell_error)) {
+        c.is_unsupported = true;
+      }
+      cells_[c.name] = std::move(c);
+    }
+  }
+  return true;
+}
+
+const LibertyCell* Liberty::cell(const std::string& name) const {
+  if (auto it = cells_.find(name); it != cells_.end()) {
+    return std::addressof(it->second);
+  }
+  return nullptr;
+}
+
+}  // namespace tb
@@ -0,0 +1,119 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_LIBERTY_H
+#define TB_LIBERTY_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace tb {
+
+// Operation of a stack machine evaluating boolean functions.
+enum class LogicOp : std::uint8_t {
+  // Push operand 'arg'.
+  Load,
+  // Push constant.
+  Zero,
+  One,
+  // Unary/binary operators on top of stack.
+  Not,
+  And,
+  Or,
+  Xor,
+  // Pop to operand 'arg' (netlist programs only).
+  Store
+};
+
+struct LogicInstr {
+  LogicOp op;
+  std::uint32_t arg;
+};
+
+// Boolean function (of a cell pin, or flop state) over a set of operands.
+struct LogicFunction {
+  bool empty() const noexcept { return code.empty(); }
+
+  std::vector<LogicInstr> code;
+
+  // Maximum stack depth.
+  std::size_t depth_n = 0;
+};
+
+// Compile the Liberty function expression 'expr' (for example,
+// "(A1&A2) | !B1") over 'operands'. On failure, returns false and sets
+// 'error'.
+bool compile_function(std::string_view expr,
+                      const std::vector<std::string>& operands,
+                      LogicFunction& f, std::string& error);
+
+struct LibertyCell {
+  std::string name;
+
+  // Function operands: input pins, followed (for flops) by the state
+  // variables 'iq' and 'iqn'.
+  std::vector<std::string> operands;
+
+  // Number of input pins (the leading operands).
+  std::size_t inputs_n = 0;
+
+  // Output pins and their functions.
+  std::vector<std::pair<std::string, LogicFunction> > outputs;
+
+  // Cell is an edge-triggered flop ('ff' group), clocked on the rising edge
+  // of input pin 'clock' (an operand index).
+  bool is_ff = false;
+  std::size_t clock = 0;
+  LogicFunction next_state;
+  LogicFunction clear;
+  LogicFunction preset;
+
+  // Cell has state which is not modelled (latch, statetable).
+  bool is_unsupported = false;
+};
+
+class Liberty {
+ public:
+  explicit Liberty() = default;
+
+  // Load cell functions from Liberty file 'fn'. On failure, returns false
+  // and sets 'error'.
+  bool load(const std::string& fn, std::string& error);
+
+  // Cell 'name', or nullptr if not present in library.
+  const LibertyCell* cell(const std::string& name) const;
+
+ private:
+  std::unordered_map<std::string, LibertyCell> cells_;
+};
+
+}  // namespace tb
+
+#endif
@@ -32,11 +32,15 @@
 namespace tb {
 
 Log::Scope::Scope() {
-  ::tb::OPTIONS.log->scope_ += step_n;
+  if (::tb::OPTIONS.log) {
+    ::tb::OPTIONS.log->scope_ += step_n;
+  }
 }
 
 Log::Scope::~Scope() {
-  ::tb::OPTIONS.log->scope_ -= step_n;
+  if (::tb::OPTIONS.log) {
+    ::tb::OPTIONS.log->scope_ -= step_n;
+  }
 }
 
 std::string_view to_string(Log::Level l) {
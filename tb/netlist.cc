@@ -0,0 +1,895 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "netlist.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <unordered_set>
+
+#include "cfg.h"
+
+namespace tb {
+
+namespace {
+
+constexpr std::size_t NET_ZERO = 0;
+constexpr std::size_t NET_ONE = 1;
+
+// Operand of a port connection or continuous assignment: a constant, or
+// a net (whole, bit- or part-select).
+struct Term {
+  // Constant bits, LSB first (when 'name' is empty).
+  std::vector<bool> value;
+
+  std::string name;
+  bool has_range = false;
+  int msb = 0, lsb = 0;
+};
+
+// Concatenation of terms, MSB first.
+using Expr = std::vector<Term>;
+
+struct Decl {
+  std::string name;
+  bool has_range = false;
+  int msb = 0, lsb = 0;
+  bool is_port = false;
+  bool is_input = false;
+};
+
+struct Instance {
+  std::string type;
+  std::string name;
+  std::vector<std::pair<std::string, Expr> > pins;
+};
+
+struct Module {
+  std::string name;
+  std::vector<Decl> decls;
+  std::vector<Instance> instances;
+  std::vector<std::pair<Expr, Expr> > assigns;
+};
+
+class VerilogParser {
+  enum class Kind { Id, Number, Punct, End };
+
+  struct Token {
+    Kind kind;
+    std::string_view text;
+
+    bool is(char c) const {
+      return (kind == Kind::Punct) && (text.front() == c);
+    }
+    bool is(std::string_view kw) const {
+      return (kind == Kind::Id) && (text == kw);
+    }
+  };
+
+ public:
+  explicit VerilogParser(std::string_view s) : s_(s) {}
+
+  bool parse(std::vector<Module>& ms, std::string& error) {
+    while (peek().kind != Kind::End) {
+      if (!next().is("module")) {
+        return fail(error, "expected 'module'");
+      }
+      if (!module(ms.emplace_back(), error)) return false;
+    }
+    return true;
+  }
+
+ private:
+  bool module(Module& m, std::string& error) {
+    const Token name = next();
+    if (name.kind != Kind::Id) return fail(error, "expected module name");
+    m.name = name.text;
+
+    // Port list; ports are subsequently declared by direction.
+    if (peek().is('(')) {
+      next();
+      for (Token t = next(); !t.is(')'); t = next()) {
+        if (t.kind == Kind::End) return fail(error, "unterminated port list");
+      }
+    }
+    if (!next().is(';')) return fail(error, "expected ';'");
+
+    while (true) {
+      const Token t = peek();
+      if (t.kind == Kind::End) return fail(error, "expected 'endmodule'");
+      if (t.is("endmodule")) {
+        next();
+        return true;
+      }
+      if (t.is("input") || t.is("output") || t.is("inout") || t.is("wire") ||
+          t.is("reg")) {
+        if (!declaration(m, error)) return false;
+      } else if (t.is("assign")) {
+        next();
+        Expr lhs, rhs;
+        if (!expr(lhs, error)) return false;
+        if (!next().is('=')) return fail(error, "expected '='");
+        if (!expr(rhs, error)) return false;
+        if (!next().is(';')) return fail(error, "expected ';'");
+        m.assigns.emplace_back(std::move(lhs), std::move(rhs));
+      } else if (t.kind == Kind::Id) {
+        if (!instance(m, error)) return false;
+      } else {
+        return fail(error, "unexpected token '" + std::string{t.text} + "'");
+      }
+    }
+  }
+
+  bool declaration(Module& m, std::string& error) {
+    const Token kind = next();
+    Decl d;
+    d.is_port = !(kind.is("wire") || kind.is("reg"));
+    d.is_input = kind.is("input");
+    if (peek().is("wire") || peek().is("reg") || peek().is("signed")) next();
+    if (peek().is('[')) {
+      next();
+      d.has_range = true;
+      if (!integer(d.msb, error) || !next().is(':') ||
+          !integer(d.lsb, error) || !next().is(']')) {
+        return fail(error, "malformed range");
+      }
+    }
+    while (true) {
+      const Token name = next();
+      if (name.kind != Kind::Id) return fail(error, "expected identifier");
+      d.name = name.text;
+      m.decls.push_back(d);
+      const Token t = next();
+      if (t.is(';')) return true;
+      if (!t.is(',')) return fail(error, "expected ',' or ';'");
+    }
+  }
+
+  bool instance(Module& m, std::string& error) {
+    Instance& inst = m.instances.emplace_back();
+    inst.type = next().text;
+    if (peek().is('#')) {
+      // Parameter overrides (ignored).
+      next();
+      if (!skip_parenthesized(error)) return false;
+    }
+    const Token name = next();
+    if (name.kind != Kind::Id) return fail(error, "expected instance name");
+    inst.name = name.text;
+    if (!next().is('(')) return fail(error, "expected '('");
+    while (!peek().is(')')) {
+      if (!next().is('.')) {
+        return fail(error, "expected named port connection");
+      }
+      const Token pin = next();
+      if (pin.kind != Kind::Id) return fail(error, "expected pin name");
+      if (!next().is('(')) return fail(error, "expected '('");
+      Expr e;
+      if (!peek().is(')') && !expr(e, error)) return false;
+      if (!next().is(')')) return fail(error, "expected ')'");
+      inst.pins.emplace_back(pin.text, std::move(e));
+      if (peek().is(',')) next();
+    }
+    next();
+    if (!next().is(';')) return fail(error, "expected ';'");
+    return true;
+  }
+
+  bool expr(Expr& e, std::string& error) {
+    if (peek().is('{')) {
+      next();
+      while (true) {
+        if (!term(e, error)) return false;
+        const Token t = next();
+        if (t.is('}')) return true;
+        if (!t.is(',')) return fail(error, "expected ',' or '}'");
+      }
+    }
+    return term(e, error);
+  }
+
+  bool term(Expr& e, std::string& error) {
+    const Token t = next();
+    Term& r = e.emplace_back();
+    if (t.kind == Kind::Number) {
+      return constant(t.text, r.value, error);
+    }
+    if (t.kind != Kind::Id) return fail(error, "expected operand");
+    r.name = t.text;
+    if (peek().is('[')) {
+      next();
+      r.has_range = true;
+      if (!integer(r.msb, error)) return false;
+      r.lsb = r.msb;
+      if (peek().is(':')) {
+        next();
+        if (!integer(r.lsb, error)) return false;
+      }
+      if (!next().is(']')) return fail(error, "expected ']'");
+    }
+    return true;
+  }
+
+  bool integer(int& v, std::string& error) {
+    const Token t = next();
+    if (t.kind != Kind::Number) return fail(error, "expected integer");
+    v = std::atoi(std::string{t.text}.c_str());
+    return true;
+  }
+
+  // Sized (or unsized decimal) constant; x/z bits are taken as zero.
+  bool constant(std::string_view s, std::vector<bool>& bits,
+                std::string& error) {
+    const std::size_t tick = s.find('\'');
+    if (tick == std::string_view::npos) {
+      unsigned long long v = std::strtoull(std::string{s}.c_str(), nullptr, 10);
+      for (std::size_t i = 0; i < 32; i++) bits.push_back((v >> i) & 1);
+      return true;
+    }
+    const std::size_t width = std::strtoull(
+        std::string{s.substr(0, tick)}.c_str(), nullptr, 10);
+    std::string_view digits{s.substr(tick + 1)};
+    if (!digits.empty() && (digits.front() == 's' || digits.front() == 'S')) {
+      digits.remove_prefix(1);
+    }
+    if (digits.empty()) return fail(error, "malformed constant");
+    const char base = std::tolower(static_cast<unsigned char>(digits.front()));
+    digits.remove_prefix(1);
+
+    if (base == 'd') {
+      unsigned long long v =
+          std::strtoull(std::string{digits}.c_str(), nullptr, 10);
+      for (std::size_t i = 0; i < width; i++) {
+        bits.push_back((i < 64) && ((v >> i) & 1));
+      }
+      return true;
+    }
+
+    const std::size_t bits_per_digit =
+        (base == 'h') ? 4 : (base == 'o') ? 3 : (base == 'b') ? 1 : 0;
+    if (bits_per_digit == 0) return fail(error, "malformed constant");
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it) {
+      if (*it == '_') continue;
+      const char c = std::tolower(static_cast<unsigned char>(*it));
+      unsigned v = 0;
+      if (std::isdigit(static_cast<unsigned char>(c))) {
+        v = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        v = 10 + (c - 'a');
+      }
+      for (std::size_t i = 0; i < bits_per_digit; i++) {
+        bits.push_back((v >> i) & 1);
+      }
+    }
+    bits.resize(width, false);
+    return true;
+  }
+
+  bool skip_parenthesized(std::string& error) {
+    if (!next().is('(')) return fail(error, "expected '('");
+    for (std::size_t depth = 1; depth != 0;) {
+      const Token t = next();
+      if (t.kind == Kind::End) return fail(error, "unbalanced parentheses");
+      if (t.is('(')) ++depth;
+      if (t.is(')')) --depth;
+    }
+    return true;
+  }
+
+  Token peek() {
+    if (!peeked_) {
+      token_ = lex();
+      peeked_ = true;
+    }
+    return token_;
+  }
+
+  Token next() {
+    const Token t = peek();
+    peeked_ = false;
+    return t;
+  }
+
+  Token lex() {
+    skip_ws_and_comments();
+    if (i_ >= s_.size()) return Token{Kind::End, {}};
+
+    const char c = s_[i_];
+    const std::size_t begin = i_;
+    if (c == '\\') {
+      // Escaped identifier, terminated by whitespace.
+      while (i_ < s_.size() &&
+             !std::isspace(static_cast<unsigned char>(s_[i_]))) {
+        ++i_;
+      }
+      return Token{Kind::Id, s_.substr(begin + 1, i_ - begin - 1)};
+    }
+    if (std::isalpha(static_cast<unsigned char>(c)) || c == '_' ||
+        c == '$') {
+      while (i_ < s_.size() &&
+             (std::isalnum(static_cast<unsigned char>(s_[i_])) ||
+              s_[i_] == '_' || s_[i_] == '$')) {
+        ++i_;
+      }
+      return Token{Kind::Id, s_.substr(begin, i_ - begin)};
+    }
+    if (std::isdigit(static_cast<unsigned char>(c)) || c == '\'') {
+      while (i_ < s_.size() &&
+             (std::isalnum(static_cast<unsigned char>(s_[i_])) ||
+              s_[i_] == '\'' || s_[i_] == '_')) {
+        ++i_;
+      }
+      return Token{Kind::Number, s_.substr(begin, i_ - begin)};
+    }
+    return Token{Kind::Punct, s_.substr(i_++, 1)};
+  }
+
+  void skip_ws_and_comments() {
+    while (i_ < s_.size()) {
+      if (s_[i_] == '\n') {
+        ++line_;
+        ++i_;
+      } else if (std::isspace(static_cast<unsigned char>(s_[i_]))) {
+        ++i_;
+      } else if (s_.substr(i_, 2) == "//") {
+        while (i_ < s_.size() && s_[i_] != '\n') ++i_;
+      } else if (s_.substr(i_, 2) == "/*" || s_.substr(i_, 2) == "(*") {
+        const std::string_view close = (s_[i_] == '/') ? "*/" : "*)";
+        const std::size_t end = s_.find(close, i_ + 2);
+        const std::size_t stop =
+            (end == std::string_view::npos) ? s_.size() : end + 2;
+        line_ += std::count(s_.begin() + i_, s_.begin() + stop, '\n');
+        i_ = stop;
+      } else {
+        break;
+      }
+    }
+  }
+
+  bool fail(std::string& error, const std::string& msg) {
+    error = msg + " on line " + std::to_string(line_);
+    return false;
+  }
+
+  std::string_view s_;
+  std::size_t i_ = 0;
+  std::size_t line_ = 1;
+  bool peeked_ = false;
+  Token token_;
+};
+
+bool any(const Netlist::Lane& l) {
+  for (std::size_t i = 0; i < sizeof(Netlist::Lane) / 8; i++) {
+    if (l[i] != 0) return true;
+  }
+  return false;
+}
+
+bool lane_bit(const Netlist::Lane& l, std::size_t i) {
+  return ((l[i >> 6] >> (i & 0x3f)) & 1) != 0;
+}
+
+void lane_set(Netlist::Lane& l, std::size_t i) {
+  l[i >> 6] |= (std::uint64_t{1} << (i & 0x3f));
+}
+
+}  // namespace
+
+// Compiles a parsed module onto a Netlist.
+class NetlistBuilder {
+  // Function (of one operand, or of a cell) evaluated to drive a net.
+  struct Gate {
+    const LogicFunction* f;
+    std::vector<std::size_t> operands;
+    std::size_t out;
+  };
+
+ public:
+  explicit NetlistBuilder(Netlist& n, const Liberty& lib) : n_(n), lib_(lib) {
+    buffer_.code.push_back(LogicInstr{LogicOp::Load, 0});
+    buffer_.depth_n = 1;
+  }
+
+  bool build(const Module& m, const std::vector<Module>& ms,
+             std::string& error) {
+    n_.nets_.assign(2, Netlist::Lane{});
+    n_.nets_[NET_ONE] = ~Netlist::Lane{};
+
+    for (const Decl& d : m.decls) {
+      declare(d);
+    }
+
+    for (const Instance& inst : m.instances) {
+      if (std::any_of(ms.begin(), ms.end(),
+                      [&](const Module& s) { return s.name == inst.type; })) {
+        error = "hierarchical netlists are not supported (instance " +
+                inst.name + "); flatten prior to writing netlist";
+        return false;
+      }
+      if (!instance(inst, error)) {
+        error = "instance " + inst.name + ": " + error;
+        return false;
+      }
+    }
+
+    for (const auto& [lhs, rhs] : m.assigns) {
+      const std::vector<std::size_t> l{resolve(lhs)}, r{resolve(rhs)};
+      // Right-hand side is truncated, or zero-extended, to the left.
+      for (std::size_t i = 0; i < l.size(); i++) {
+        const std::size_t src =
+            (i < r.size()) ? r[r.size() - 1 - i] : NET_ZERO;
+        gates_.push_back(Gate{&buffer_, {src}, l[l.size() - 1 - i]});
+      }
+    }
+
+    return levelise(error);
+  }
+
+ private:
+  void declare(const Decl& d) {
+    if (d.is_port) {
+      n_.ports_.push_back(d.name);
+    }
+    auto it = n_.buses_.find(d.name);
+    if (it == n_.buses_.end()) {
+      Netlist::Bus b{d.msb, d.lsb, n_.nets_.size()};
+      if (!d.has_range) {
+        b.msb = b.lsb = 0;
+      }
+      n_.nets_.resize(n_.nets_.size() + width(b), Netlist::Lane{});
+      it = n_.buses_.emplace(d.name, b).first;
+    }
+    // Otherwise, port and net declaration of same signal.
+    if (d.is_input) {
+      for (std::size_t i = 0; i < width(it->second); i++) {
+        inputs_.insert(it->second.base + i);
+      }
+    }
+  }
+
+  static std::size_t width(const Netlist::Bus& b) {
+    return static_cast<std::size_t>(std::abs(b.msb - b.lsb)) + 1;
+  }
+
+  // Net of bit 'i' of bus 'b'.
+  static std::size_t bit(const Netlist::Bus& b, int i) {
+    const int offset = (b.msb >= b.lsb) ? (i - b.lsb) : (b.lsb - i);
+    return b.base + static_cast<std::size_t>(offset);
+  }
+
+  // Nets of expression, MSB first.
+  std::vector<std::size_t> resolve(const Expr& e) {
+    std::vector<std::size_t> nets;
+    for (const Term& t : e) {
+      if (t.name.empty()) {
+        for (auto it = t.value.rbegin(); it != t.value.rend(); ++it) {
+          nets.push_back(*it ? NET_ONE : NET_ZERO);
+        }
+        continue;
+      }
+      auto it = n_.buses_.find(t.name);
+      if (it == n_.buses_.end()) {
+        // Implicitly declared (scalar) net.
+        declare(Decl{t.name});
+        it = n_.buses_.find(t.name);
+      }
+      const Netlist::Bus& b{it->second};
+      const int msb = t.has_range ? t.msb : b.msb;
+      const int lsb = t.has_range ? t.lsb : b.lsb;
+      const int step = (msb >= lsb) ? -1 : 1;
+      for (int i = msb;; i += step) {
+        nets.push_back(bit(b, i));
+        if (i == lsb) break;
+      }
+    }
+    return nets;
+  }
+
+  bool instance(const Instance& inst, std::string& error) {
+    const LibertyCell* c = lib_.cell(inst.type);
+    if (!c) {
+      error = "unknown cell " + inst.type;
+      return false;
+    }
+    if (c->is_unsupported) {
+      error = "cell " + inst.type + " cannot be modelled";
+      return false;
+    }
+
+    // Operand nets; unconnected inputs are tied low.
+    std::vector<std::size_t> operands(c->operands.size(), NET_ZERO);
+    for (const auto& [pin, e] : inst.pins) {
+      auto it = std::find(c->operands.begin(),
+                          c->operands.begin() + c->inputs_n, pin);
+      if (it == c->operands.begin() + c->inputs_n) continue;
+      const std::vector<std::size_t> nets{resolve(e)};
+      if (nets.size() > 1) {
+        error = "pin " + pin + " is connected to a bus";
+        return false;
+      }
+      if (!nets.empty()) {
+        operands[std::distance(c->operands.begin(), it)] = nets.front();
+      }
+    }
+
+    if (c->is_ff && !clock(inst, *c, error)) {
+      return false;
+    }
+
+    if (c->is_ff) {
+      Netlist::Flop f;
+      f.iq = allocate();
+      f.iqn = allocate();
+      f.next = allocate();
+      n_.nets_[f.iqn] = ~Netlist::Lane{};
+      operands[c->inputs_n] = f.iq;
+      operands[c->inputs_n + 1] = f.iqn;
+      n_.flops_.push_back(f);
+      flop_cells_.push_back(c);
+      flop_operands_.push_back(operands);
+    }
+
+    for (const auto& [pin, e] : inst.pins) {
+      auto it = std::find_if(c->outputs.begin(), c->outputs.end(),
+                             [&](const auto& o) { return o.first == pin; });
+      if (it == c->outputs.end()) continue;
+      const std::vector<std::size_t> nets{resolve(e)};
+      if (nets.size() > 1) {
+        error = "pin " + pin + " is connected to a bus";
+        return false;
+      }
+      if (!nets.empty()) {
+        gates_.push_back(Gate{&it->second, operands, nets.front()});
+      }
+    }
+    return true;
+  }
+
+  // Flops are evaluated as if clocked together (see: Netlist::settle); each
+  // must therefore be clocked by the same top-level input, rather than by a
+  // derived (gated, divided or inverted) clock.
+  bool clock(const Instance& inst, const LibertyCell& c, std::string& error) {
+    const std::string& pin = c.operands[c.clock];
+    auto it = std::find_if(inst.pins.begin(), inst.pins.end(),
+                           [&](const auto& p) { return p.first == pin; });
+    const std::vector<std::size_t> nets{
+        (it != inst.pins.end()) ? resolve(it->second)
+                                : std::vector<std::size_t>{}};
+    if (nets.size() != 1) {
+      error = "clock pin " + pin + " is not connected to a single net";
+      return false;
+    }
+    if (inputs_.count(nets.front()) == 0) {
+      error = "clock pin " + pin + " is not driven by a top-level input";
+      return false;
+    }
+    if (clock_ && (*clock_ != nets.front())) {
+      error = "flops are clocked by more than one clock";
+      return false;
+    }
+    clock_ = nets.front();
+    return true;
+  }
+
+  std::size_t allocate() {
+    n_.nets_.push_back(Netlist::Lane{});
+    return n_.nets_.size() - 1;
+  }
+
+  // Order gates such that each is evaluated after the gates driving its
+  // operands, and emit programs.
+  bool levelise(std::string& error) {
+    const std::size_t none = gates_.size();
+    std::vector<std::size_t> driver(n_.nets_.size(), none);
+    for (std::size_t g = 0; g < gates_.size(); g++) {
+      const std::size_t out = gates_[g].out;
+      if (out == NET_ZERO || out == NET_ONE) {
+        error = "constant is driven";
+        return false;
+      }
+      if (driver[out] != none) {
+        error = "net is driven by multiple cells";
+        return false;
+      }
+      driver[out] = g;
+    }
+
+    std::vector<std::size_t> pending(gates_.size(), 0);
+    std::vector<std::vector<std::size_t> > fanout(gates_.size());
+    std::vector<std::size_t> ready;
+    for (std::size_t g = 0; g < gates_.size(); g++) {
+      for (const std::size_t op : gates_[g].operands) {
+        if (driver[op] != none) {
+          ++pending[g];
+          fanout[driver[op]].push_back(g);
+        }
+      }
+      if (pending[g] == 0) ready.push_back(g);
+    }
+
+    std::size_t depth_n = 0;
+    std::size_t scheduled_n = 0;
+    while (!ready.empty()) {
+      const std::size_t g = ready.back();
+      ready.pop_back();
+      ++scheduled_n;
+      emit(n_.comb_, *gates_[g].f, gates_[g].operands);
+      n_.comb_.push_back(LogicInstr{LogicOp::Store, to_arg(gates_[g].out)});
+      depth_n = std::max(depth_n, gates_[g].f->depth_n);
+      for (const std::size_t s : fanout[g]) {
+        if (--pending[s] == 0) ready.push_back(s);
+      }
+    }
+    if (scheduled_n != gates_.size()) {
+      error = "netlist contains a combinational loop";
+      return false;
+    }
+
+    for (std::size_t i = 0; i < n_.flops_.size(); i++) {
+      const LibertyCell* c = flop_cells_[i];
+      const std::vector<std::size_t>& operands = flop_operands_[i];
+      emit(n_.next_, c->next_state, operands);
+      depth_n = std::max(depth_n, c->next_state.depth_n);
+      if (!c->clear.empty()) {
+        emit(n_.next_, c->clear, operands);
+        n_.next_.push_back(LogicInstr{LogicOp::Not, 0});
+        n_.next_.push_back(LogicInstr{LogicOp::And, 0});
+        depth_n = std::max(depth_n, 1 + c->clear.depth_n);
+      }
+      if (!c->preset.empty()) {
+        emit(n_.next_, c->preset, operands);
+        n_.next_.push_back(LogicInstr{LogicOp::Or, 0});
+        depth_n = std::max(depth_n, 1 + c->preset.depth_n);
+      }
+      n_.next_.push_back(LogicInstr{LogicOp::Store, to_arg(n_.flops_[i].next)});
+    }
+
+    n_.stack_.assign(depth_n, Netlist::Lane{});
+    return true;
+  }
+
+  static void emit(std::vector<LogicInstr>& p, const LogicFunction& f,
+                   const std::vector<std::size_t>& operands) {
+    for (LogicInstr i : f.code) {
+      if (i.op == LogicOp::Load) {
+        i.arg = to_arg(operands[i.arg]);
+      }
+      p.push_back(i);
+    }
+  }
+
+  static std::uint32_t to_arg(std::size_t net) {
+    return static_cast<std::uint32_t>(net);
+  }
+
+  Netlist& n_;
+  const Liberty& lib_;
+  LogicFunction buffer_;
+  std::vector<Gate> gates_;
+  std::vector<const LibertyCell*> flop_cells_;
+  std::vector<std::vector<std::size_t> > flop_operands_;
+  // Nets of top-level inputs, and that by which flops are clocked (if any).
+  std::unordered_set<std::size_t> inputs_;
+  std::optional<std::size_t> clock_;
+};
+
+bool Netlist::load(const std::string& fn, const Liberty& lib,
+                   std::string& error) {
+  std::ifstream is{fn};
+  if (!is) {
+    error = "unable to open " + fn;
+    return false;
+  }
+  std::ostringstream ss;
+  ss << is.rdbuf();
+  const std::string s{ss.str()};
+
+  std::vector<Module> ms;
+  if (!VerilogParser{s}.parse(ms, error)) {
+    error = fn + ": " + error;
+    return false;
+  }
+  if (ms.empty()) {
+    error = fn + ": no module";
+    return false;
+  }
+
+  // Top-level: module 'top' if present, otherwise the last module.
+  auto top = std::find_if(ms.begin(), ms.end(),
+                          [](const Module& m) { return m.name == "top"; });
+  if (top == ms.end()) {
+    top = std::prev(ms.end());
+  }
+
+  if (!NetlistBuilder{*this, lib}.build(*top, ms, error)) {
+    error = fn + ": " + error;
+    return false;
+  }
+  return true;
+}
+
+std::vector<std::size_t> Netlist::port(const std::string& name) const {
+  std::vector<std::size_t> nets;
+  if (std::find(ports_.begin(), ports_.end(), name) == ports_.end()) {
+    return nets;
+  }
+  const Bus& b{buses_.at(name)};
+  for (std::size_t i = 0; i <= static_cast<std::size_t>(std::abs(b.msb - b.lsb));
+       i++) {
+    nets.push_back(b.base + i);
+  }
+  return nets;
+}
+
+void Netlist::run(const std::vector<LogicInstr>& p) {
+  Lane* sp = stack_.data();
+  for (const LogicInstr& i : p) {
+    switch (i.op) {
+      case LogicOp::Load:
+        *sp++ = nets_[i.arg];
+        break;
+      case LogicOp::Zero:
+        *sp++ = Lane{};
+        break;
+      case LogicOp::One:
+        *sp++ = ~Lane{};
+        break;
+      case LogicOp::Not:
+        sp[-1] = ~sp[-1];
+        break;
+      case LogicOp::And:
+        --sp;
+        sp[-1] &= sp[0];
+        break;
+      case LogicOp::Or:
+        --sp;
+        sp[-1] |= sp[0];
+        break;
+      case LogicOp::Xor:
+        --sp;
+        sp[-1] ^= sp[0];
+        break;
+      case LogicOp::Store:
+        nets_[i.arg] = *--sp;
+        break;
+    }
+  }
+}
+
+void Netlist::settle() {
+  run(comb_);
+  // Bounded, as state need not converge in the presence of feedback.
+  for (std::size_t i = 0; i <= flops_.size(); i++) {
+    run(next_);
+    bool changed = false;
+    for (const Flop& f : flops_) {
+      changed = changed || any(nets_[f.next] ^ nets_[f.iq]);
+      nets_[f.iq] = nets_[f.next];
+      nets_[f.iqn] = ~nets_[f.next];
+    }
+    if (!changed) break;
+    run(comb_);
+  }
+}
+
+NetlistDesign::NetlistDesign(const std::string& name,
+                             std::shared_ptr<const Netlist> n)
+    : DesignBase(name), n_(*n) {
+  i_x_ = n_.port("i_x");
+  o_is_unary_ = n_.port("o_is_unary").front();
+  o_is_compliment_ = n_.port("o_is_compliment").front();
+}
+
+std::tuple<bool, bool> NetlistDesign::is_unary(
+    const StimulusVector& v) noexcept {
+  return is_unary_stream({v}).front();
+}
+
+std::vector<std::tuple<bool, bool> > NetlistDesign::is_unary_stream(
+    const std::vector<StimulusVector>& vs) noexcept {
+  std::vector<std::tuple<bool, bool> > rs;
+  rs.reserve(vs.size());
+  for (std::size_t base = 0; base < vs.size(); base += Netlist::lanes_n) {
+    const std::size_t n = std::min(Netlist::lanes_n, vs.size() - base);
+    // Transpose: vector 'i' is evaluated in lane 'i'.
+    for (std::size_t b = 0; b < i_x_.size(); b++) {
+      Netlist::Lane l{};
+      for (std::size_t i = 0; i < n; i++) {
+        if (vs[base + i].bit(b)) lane_set(l, i);
+      }
+      n_.net(i_x_[b]) = l;
+    }
+    n_.settle();
+    const Netlist::Lane u{n_.net(o_is_unary_)};
+    const Netlist::Lane c{n_.net(o_is_compliment_)};
+    for (std::size_t i = 0; i < n; i++) {
+      rs.emplace_back(lane_bit(u, i), lane_bit(c, i));
+    }
+  }
+  return rs;
+}
+
+namespace {
+
+class NetlistDesignBuilder : public DesignRegistry::DesignBuilderBase {
+ public:
+  explicit NetlistDesignBuilder(const std::string& name,
+                                std::shared_ptr<const Netlist> n)
+      : name_(name), n_(n) {}
+
+  std::unique_ptr<DesignBase> construct() const override {
+    return std::unique_ptr<DesignBase>(new NetlistDesign(name_, n_));
+  }
+
+ private:
+  std::string name_;
+  std::shared_ptr<const Netlist> n_;
+};
+
+}  // namespace
+
+bool register_netlist(const std::string& name, const std::string& fn,
+                      const std::string& lib, std::string& error) {
+  // Libraries are large; parse each once.
+  static std::map<std::string, std::shared_ptr<Liberty> > libs;
+  std::shared_ptr<Liberty>& l = libs[lib];
+  if (!l) {
+    auto nl = std::make_shared<Liberty>();
+    if (!nl->load(lib, error)) {
+      return false;
+    }
+    l = nl;
+  }
+
+  auto n = std::make_shared<Netlist>();
+  if (!n->load(fn, *l, error)) {
+    return false;
+  }
+
+  // Validate interface.
+  if (n->port("i_x").size() != cfg::W) {
+    error = fn + ": expected port i_x[" + std::to_string(cfg::W) + "]";
+    return false;
+  }
+  for (const char* p : {"o_is_unary", "o_is_compliment"}) {
+    if (n->port(p).size() != 1) {
+      error = fn + ": expected scalar port " + p;
+      return false;
+    }
+  }
+
+  DESIGN_REGISTRY.add(name, std::make_unique<NetlistDesignBuilder>(name, n));
+  return true;
+}
+
+}  // namespace tb
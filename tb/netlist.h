@@ -0,0 +1,129 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_NETLIST_H
+#define TB_NETLIST_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "designs.h"
+#include "liberty.h"
+#include "stimulus.h"
+
+namespace tb {
+
+// Gate-level netlist (as emitted by Yosys 'write_verilog -noattr -noexpr'),
+// compiled to a levelised program which evaluates one independent vector
+// per bit of a lane.
+class Netlist {
+ public:
+#ifdef __AVX2__
+  using Lane = std::uint64_t __attribute__((vector_size(32)));
+#else
+  using Lane = std::uint64_t __attribute__((vector_size(8)));
+#endif
+
+  // Vectors evaluated per pass.
+  static constexpr std::size_t lanes_n = 8 * sizeof(Lane);
+
+  explicit Netlist() = default;
+
+  // Load (flattened) top-level module of netlist 'fn', whose cells are
+  // defined by 'lib'. On failure, returns false and sets 'error'.
+  bool load(const std::string& fn, const Liberty& lib, std::string& error);
+
+  // Nets of port 'name', LSB first; empty if no such port exists.
+  std::vector<std::size_t> port(const std::string& name) const;
+
+  Lane& net(std::size_t i) noexcept { return nets_[i]; }
+
+  // Evaluate combinational logic, then clock flops until their state no
+  // longer changes (that is, until a pipeline has fully propagated its
+  // inputs). Flops share one clock, a top-level input, on whose rising edge
+  // they are clocked (see: load).
+  void settle();
+
+ private:
+  struct Bus {
+    int msb, lsb;
+    std::size_t base;
+  };
+
+  struct Flop {
+    std::size_t iq, iqn, next;
+  };
+
+  void run(const std::vector<LogicInstr>& p);
+
+  // Net values; nets 0 and 1 are constants.
+  std::vector<Lane> nets_;
+  std::unordered_map<std::string, Bus> buses_;
+  std::vector<std::string> ports_;
+
+  // Combinational logic, in level order.
+  std::vector<LogicInstr> comb_;
+
+  // Flop next-state logic.
+  std::vector<LogicInstr> next_;
+  std::vector<Flop> flops_;
+
+  std::vector<Lane> stack_;
+
+  friend class NetlistBuilder;
+};
+
+// Synthesized netlist under test; evaluates vectors in batches of
+// Netlist::lanes_n.
+class NetlistDesign : public DesignBase {
+ public:
+  explicit NetlistDesign(const std::string& name,
+                         std::shared_ptr<const Netlist> n);
+
+  std::tuple<bool, bool> is_unary(const StimulusVector& v) noexcept override;
+
+  std::vector<std::tuple<bool, bool> > is_unary_stream(
+      const std::vector<StimulusVector>& vs) noexcept override;
+
+ private:
+  Netlist n_;
+  std::vector<std::size_t> i_x_;
+  std::size_t o_is_unary_, o_is_compliment_;
+};
+
+// Register netlist 'fn' (cells defined by Liberty file 'lib') as design
+// 'name'. On failure, returns false and sets 'error'.
+bool register_netlist(const std::string& name, const std::string& fn,
+                      const std::string& lib, std::string& error);
+
+}  // namespace tb
+
+#endif
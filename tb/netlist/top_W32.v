@@ -0,0 +1,873 @@
+// Netlist test fixture (see: tb/CMakeLists.txt, test 'netlist'): a
+// flop-bounded, edge-counting unary detector (W=32, compliment admission
+// enabled) with the ports of syn/top.sv.tmpl, over the cells of
+// sky130_fd_sc_hd.lib. Written by hand in the form written by Yosys
+// ('write_verilog -noattr -noexpr'); netlists synthesized by the flow are
+// loaded by test 'netlist_syn'.
+module top(i_x, o_is_unary, o_is_compliment, clk);
+  wire _0001_;
+  wire _0002_;
+  wire _0003_;
+  wire _0004_;
+  wire _0005_;
+  wire _0006_;
+  wire _0007_;
+  wire _0008_;
+  wire _0009_;
+  wire _0010_;
+  wire _0011_;
+  wire _0012_;
+  wire _0013_;
+  wire _0014_;
+  wire _0015_;
+  wire _0016_;
+  wire _0017_;
+  wire _0018_;
+  wire _0019_;
+  wire _0020_;
+  wire _0021_;
+  wire _0022_;
+  wire _0023_;
+  wire _0024_;
+  wire _0025_;
+  wire _0026_;
+  wire _0027_;
+  wire _0028_;
+  wire _0029_;
+  wire _0030_;
+  wire _0031_;
+  wire _0032_;
+  wire _0065_;
+  wire _0067_;
+  wire _0069_;
+  wire _0071_;
+  wire _0073_;
+  wire _0075_;
+  wire _0077_;
+  wire _0079_;
+  wire _0081_;
+  wire _0083_;
+  wire _0085_;
+  wire _0087_;
+  wire _0089_;
+  wire _0091_;
+  wire _0093_;
+  wire _0095_;
+  wire _0097_;
+  wire _0099_;
+  wire _0101_;
+  wire _0103_;
+  wire _0105_;
+  wire _0107_;
+  wire _0109_;
+  wire _0111_;
+  wire _0113_;
+  wire _0115_;
+  wire _0117_;
+  wire _0119_;
+  wire _0121_;
+  wire _0123_;
+  wire _0125_;
+  wire _0127_;
+  wire _0129_;
+  wire _0131_;
+  wire _0133_;
+  wire _0135_;
+  wire _0137_;
+  wire _0139_;
+  wire _0141_;
+  wire _0143_;
+  wire _0145_;
+  wire _0147_;
+  wire _0149_;
+  wire _0151_;
+  wire _0153_;
+  wire _0155_;
+  wire _0157_;
+  wire _0159_;
+  wire _0161_;
+  wire _0163_;
+  wire _0165_;
+  wire _0167_;
+  wire _0169_;
+  wire _0171_;
+  wire _0173_;
+  wire _0175_;
+  wire _0177_;
+  wire _0179_;
+  wire _0181_;
+  wire _0183_;
+  wire _0185_;
+  wire _0187_;
+  wire _0189_;
+  wire _0191_;
+  wire _0193_;
+  wire _0195_;
+  wire _0197_;
+  wire _0199_;
+  wire _0201_;
+  wire _0203_;
+  wire _0205_;
+  wire _0207_;
+  wire _0209_;
+  wire _0211_;
+  wire _0213_;
+  wire _0215_;
+  wire _0217_;
+  wire _0219_;
+  wire _0221_;
+  wire _0223_;
+  wire _0225_;
+  wire _0227_;
+  wire _0229_;
+  wire _0231_;
+  wire _0233_;
+  wire _0235_;
+  wire _0237_;
+  wire _0239_;
+  wire _0241_;
+  wire _0243_;
+  wire _0245_;
+  wire _0247_;
+  wire _0249_;
+  wire _0251_;
+  wire _0253_;
+  wire _0255_;
+  wire _0257_;
+  wire _0259_;
+  wire _0261_;
+  wire _0263_;
+  wire _0265_;
+  wire _0267_;
+  wire _0269_;
+  wire _0271_;
+  wire _0273_;
+  wire _0275_;
+  wire _0277_;
+  input clk;
+  wire clk;
+  input [31:0] i_x;
+  wire [31:0] i_x;
+  output o_is_compliment;
+  wire o_is_compliment;
+  output o_is_unary;
+  wire o_is_unary;
+  sky130_fd_sc_hd__dfxtp_1 _0033_ (
+    .CLK(clk),
+    .D(i_x[0]),
+    .Q(_0001_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0034_ (
+    .CLK(clk),
+    .D(i_x[1]),
+    .Q(_0002_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0035_ (
+    .CLK(clk),
+    .D(i_x[2]),
+    .Q(_0003_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0036_ (
+    .CLK(clk),
+    .D(i_x[3]),
+    .Q(_0004_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0037_ (
+    .CLK(clk),
+    .D(i_x[4]),
+    .Q(_0005_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0038_ (
+    .CLK(clk),
+    .D(i_x[5]),
+    .Q(_0006_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0039_ (
+    .CLK(clk),
+    .D(i_x[6]),
+    .Q(_0007_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0040_ (
+    .CLK(clk),
+    .D(i_x[7]),
+    .Q(_0008_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0041_ (
+    .CLK(clk),
+    .D(i_x[8]),
+    .Q(_0009_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0042_ (
+    .CLK(clk),
+    .D(i_x[9]),
+    .Q(_0010_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0043_ (
+    .CLK(clk),
+    .D(i_x[10]),
+    .Q(_0011_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0044_ (
+    .CLK(clk),
+    .D(i_x[11]),
+    .Q(_0012_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0045_ (
+    .CLK(clk),
+    .D(i_x[12]),
+    .Q(_0013_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0046_ (
+    .CLK(clk),
+    .D(i_x[13]),
+    .Q(_0014_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0047_ (
+    .CLK(clk),
+    .D(i_x[14]),
+    .Q(_0015_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0048_ (
+    .CLK(clk),
+    .D(i_x[15]),
+    .Q(_0016_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0049_ (
+    .CLK(clk),
+    .D(i_x[16]),
+    .Q(_0017_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0050_ (
+    .CLK(clk),
+    .D(i_x[17]),
+    .Q(_0018_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0051_ (
+    .CLK(clk),
+    .D(i_x[18]),
+    .Q(_0019_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0052_ (
+    .CLK(clk),
+    .D(i_x[19]),
+    .Q(_0020_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0053_ (
+    .CLK(clk),
+    .D(i_x[20]),
+    .Q(_0021_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0054_ (
+    .CLK(clk),
+    .D(i_x[21]),
+    .Q(_0022_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0055_ (
+    .CLK(clk),
+    .D(i_x[22]),
+    .Q(_0023_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0056_ (
+    .CLK(clk),
+    .D(i_x[23]),
+    .Q(_0024_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0057_ (
+    .CLK(clk),
+    .D(i_x[24]),
+    .Q(_0025_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0058_ (
+    .CLK(clk),
+    .D(i_x[25]),
+    .Q(_0026_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0059_ (
+    .CLK(clk),
+    .D(i_x[26]),
+    .Q(_0027_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0060_ (
+    .CLK(clk),
+    .D(i_x[27]),
+    .Q(_0028_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0061_ (
+    .CLK(clk),
+    .D(i_x[28]),
+    .Q(_0029_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0062_ (
+    .CLK(clk),
+    .D(i_x[29]),
+    .Q(_0030_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0063_ (
+    .CLK(clk),
+    .D(i_x[30]),
+    .Q(_0031_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0064_ (
+    .CLK(clk),
+    .D(i_x[31]),
+    .Q(_0032_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0066_ (
+    .A(_0002_),
+    .B(_0001_),
+    .X(_0065_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0068_ (
+    .A(_0003_),
+    .B(_0002_),
+    .X(_0067_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0070_ (
+    .A(_0004_),
+    .B(_0003_),
+    .X(_0069_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0072_ (
+    .A(_0005_),
+    .B(_0004_),
+    .X(_0071_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0074_ (
+    .A(_0006_),
+    .B(_0005_),
+    .X(_0073_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0076_ (
+    .A(_0007_),
+    .B(_0006_),
+    .X(_0075_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0078_ (
+    .A(_0008_),
+    .B(_0007_),
+    .X(_0077_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0080_ (
+    .A(_0009_),
+    .B(_0008_),
+    .X(_0079_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0082_ (
+    .A(_0010_),
+    .B(_0009_),
+    .X(_0081_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0084_ (
+    .A(_0011_),
+    .B(_0010_),
+    .X(_0083_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0086_ (
+    .A(_0012_),
+    .B(_0011_),
+    .X(_0085_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0088_ (
+    .A(_0013_),
+    .B(_0012_),
+    .X(_0087_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0090_ (
+    .A(_0014_),
+    .B(_0013_),
+    .X(_0089_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0092_ (
+    .A(_0015_),
+    .B(_0014_),
+    .X(_0091_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0094_ (
+    .A(_0016_),
+    .B(_0015_),
+    .X(_0093_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0096_ (
+    .A(_0017_),
+    .B(_0016_),
+    .X(_0095_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0098_ (
+    .A(_0018_),
+    .B(_0017_),
+    .X(_0097_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0100_ (
+    .A(_0019_),
+    .B(_0018_),
+    .X(_0099_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0102_ (
+    .A(_0020_),
+    .B(_0019_),
+    .X(_0101_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0104_ (
+    .A(_0021_),
+    .B(_0020_),
+    .X(_0103_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0106_ (
+    .A(_0022_),
+    .B(_0021_),
+    .X(_0105_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0108_ (
+    .A(_0023_),
+    .B(_0022_),
+    .X(_0107_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0110_ (
+    .A(_0024_),
+    .B(_0023_),
+    .X(_0109_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0112_ (
+    .A(_0025_),
+    .B(_0024_),
+    .X(_0111_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0114_ (
+    .A(_0026_),
+    .B(_0025_),
+    .X(_0113_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0116_ (
+    .A(_0027_),
+    .B(_0026_),
+    .X(_0115_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0118_ (
+    .A(_0028_),
+    .B(_0027_),
+    .X(_0117_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0120_ (
+    .A(_0029_),
+    .B(_0028_),
+    .X(_0119_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0122_ (
+    .A(_0030_),
+    .B(_0029_),
+    .X(_0121_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0124_ (
+    .A(_0031_),
+    .B(_0030_),
+    .X(_0123_)
+  );
+  sky130_fd_sc_hd__xor2_1 _0126_ (
+    .A(_0032_),
+    .B(_0031_),
+    .X(_0125_)
+  );
+  sky130_fd_sc_hd__or2_1 _0128_ (
+    .A(_0065_),
+    .B(_0067_),
+    .X(_0127_)
+  );
+  sky130_fd_sc_hd__and2_1 _0130_ (
+    .A(_0065_),
+    .B(_0067_),
+    .X(_0129_)
+  );
+  sky130_fd_sc_hd__or2_1 _0132_ (
+    .A(_0069_),
+    .B(_0071_),
+    .X(_0131_)
+  );
+  sky130_fd_sc_hd__and2_1 _0134_ (
+    .A(_0069_),
+    .B(_0071_),
+    .X(_0133_)
+  );
+  sky130_fd_sc_hd__or2_1 _0136_ (
+    .A(_0073_),
+    .B(_0075_),
+    .X(_0135_)
+  );
+  sky130_fd_sc_hd__and2_1 _0138_ (
+    .A(_0073_),
+    .B(_0075_),
+    .X(_0137_)
+  );
+  sky130_fd_sc_hd__or2_1 _0140_ (
+    .A(_0077_),
+    .B(_0079_),
+    .X(_0139_)
+  );
+  sky130_fd_sc_hd__and2_1 _0142_ (
+    .A(_0077_),
+    .B(_0079_),
+    .X(_0141_)
+  );
+  sky130_fd_sc_hd__or2_1 _0144_ (
+    .A(_0081_),
+    .B(_0083_),
+    .X(_0143_)
+  );
+  sky130_fd_sc_hd__and2_1 _0146_ (
+    .A(_0081_),
+    .B(_0083_),
+    .X(_0145_)
+  );
+  sky130_fd_sc_hd__or2_1 _0148_ (
+    .A(_0085_),
+    .B(_0087_),
+    .X(_0147_)
+  );
+  sky130_fd_sc_hd__and2_1 _0150_ (
+    .A(_0085_),
+    .B(_0087_),
+    .X(_0149_)
+  );
+  sky130_fd_sc_hd__or2_1 _0152_ (
+    .A(_0089_),
+    .B(_0091_),
+    .X(_0151_)
+  );
+  sky130_fd_sc_hd__and2_1 _0154_ (
+    .A(_0089_),
+    .B(_0091_),
+    .X(_0153_)
+  );
+  sky130_fd_sc_hd__or2_1 _0156_ (
+    .A(_0093_),
+    .B(_0095_),
+    .X(_0155_)
+  );
+  sky130_fd_sc_hd__and2_1 _0158_ (
+    .A(_0093_),
+    .B(_0095_),
+    .X(_0157_)
+  );
+  sky130_fd_sc_hd__or2_1 _0160_ (
+    .A(_0097_),
+    .B(_0099_),
+    .X(_0159_)
+  );
+  sky130_fd_sc_hd__and2_1 _0162_ (
+    .A(_0097_),
+    .B(_0099_),
+    .X(_0161_)
+  );
+  sky130_fd_sc_hd__or2_1 _0164_ (
+    .A(_0101_),
+    .B(_0103_),
+    .X(_0163_)
+  );
+  sky130_fd_sc_hd__and2_1 _0166_ (
+    .A(_0101_),
+    .B(_0103_),
+    .X(_0165_)
+  );
+  sky130_fd_sc_hd__or2_1 _0168_ (
+    .A(_0105_),
+    .B(_0107_),
+    .X(_0167_)
+  );
+  sky130_fd_sc_hd__and2_1 _0170_ (
+    .A(_0105_),
+    .B(_0107_),
+    .X(_0169_)
+  );
+  sky130_fd_sc_hd__or2_1 _0172_ (
+    .A(_0109_),
+    .B(_0111_),
+    .X(_0171_)
+  );
+  sky130_fd_sc_hd__and2_1 _0174_ (
+    .A(_0109_),
+    .B(_0111_),
+    .X(_0173_)
+  );
+  sky130_fd_sc_hd__or2_1 _0176_ (
+    .A(_0113_),
+    .B(_0115_),
+    .X(_0175_)
+  );
+  sky130_fd_sc_hd__and2_1 _0178_ (
+    .A(_0113_),
+    .B(_0115_),
+    .X(_0177_)
+  );
+  sky130_fd_sc_hd__or2_1 _0180_ (
+    .A(_0117_),
+    .B(_0119_),
+    .X(_0179_)
+  );
+  sky130_fd_sc_hd__and2_1 _0182_ (
+    .A(_0117_),
+    .B(_0119_),
+    .X(_0181_)
+  );
+  sky130_fd_sc_hd__or2_1 _0184_ (
+    .A(_0121_),
+    .B(_0123_),
+    .X(_0183_)
+  );
+  sky130_fd_sc_hd__and2_1 _0186_ (
+    .A(_0121_),
+    .B(_0123_),
+    .X(_0185_)
+  );
+  sky130_fd_sc_hd__or2_1 _0188_ (
+    .A(_0127_),
+    .B(_0131_),
+    .X(_0187_)
+  );
+  sky130_fd_sc_hd__and2_1 _0190_ (
+    .A(_0127_),
+    .B(_0131_),
+    .X(_0189_)
+  );
+  sky130_fd_sc_hd__or3_1 _0192_ (
+    .A(_0189_),
+    .B(_0129_),
+    .C(_0133_),
+    .X(_0191_)
+  );
+  sky130_fd_sc_hd__or2_1 _0194_ (
+    .A(_0135_),
+    .B(_0139_),
+    .X(_0193_)
+  );
+  sky130_fd_sc_hd__and2_1 _0196_ (
+    .A(_0135_),
+    .B(_0139_),
+    .X(_0195_)
+  );
+  sky130_fd_sc_hd__or3_1 _0198_ (
+    .A(_0195_),
+    .B(_0137_),
+    .C(_0141_),
+    .X(_0197_)
+  );
+  sky130_fd_sc_hd__or2_1 _0200_ (
+    .A(_0143_),
+    .B(_0147_),
+    .X(_0199_)
+  );
+  sky130_fd_sc_hd__and2_1 _0202_ (
+    .A(_0143_),
+    .B(_0147_),
+    .X(_0201_)
+  );
+  sky130_fd_sc_hd__or3_1 _0204_ (
+    .A(_0201_),
+    .B(_0145_),
+    .C(_0149_),
+    .X(_0203_)
+  );
+  sky130_fd_sc_hd__or2_1 _0206_ (
+    .A(_0151_),
+    .B(_0155_),
+    .X(_0205_)
+  );
+  sky130_fd_sc_hd__and2_1 _0208_ (
+    .A(_0151_),
+    .B(_0155_),
+    .X(_0207_)
+  );
+  sky130_fd_sc_hd__or3_1 _0210_ (
+    .A(_0207_),
+    .B(_0153_),
+    .C(_0157_),
+    .X(_0209_)
+  );
+  sky130_fd_sc_hd__or2_1 _0212_ (
+    .A(_0159_),
+    .B(_0163_),
+    .X(_0211_)
+  );
+  sky130_fd_sc_hd__and2_1 _0214_ (
+    .A(_0159_),
+    .B(_0163_),
+    .X(_0213_)
+  );
+  sky130_fd_sc_hd__or3_1 _0216_ (
+    .A(_0213_),
+    .B(_0161_),
+    .C(_0165_),
+    .X(_0215_)
+  );
+  sky130_fd_sc_hd__or2_1 _0218_ (
+    .A(_0167_),
+    .B(_0171_),
+    .X(_0217_)
+  );
+  sky130_fd_sc_hd__and2_1 _0220_ (
+    .A(_0167_),
+    .B(_0171_),
+    .X(_0219_)
+  );
+  sky130_fd_sc_hd__or3_1 _0222_ (
+    .A(_0219_),
+    .B(_0169_),
+    .C(_0173_),
+    .X(_0221_)
+  );
+  sky130_fd_sc_hd__or2_1 _0224_ (
+    .A(_0175_),
+    .B(_0179_),
+    .X(_0223_)
+  );
+  sky130_fd_sc_hd__and2_1 _0226_ (
+    .A(_0175_),
+    .B(_0179_),
+    .X(_0225_)
+  );
+  sky130_fd_sc_hd__or3_1 _0228_ (
+    .A(_0225_),
+    .B(_0177_),
+    .C(_0181_),
+    .X(_0227_)
+  );
+  sky130_fd_sc_hd__or2_1 _0230_ (
+    .A(_0183_),
+    .B(_0125_),
+    .X(_0229_)
+  );
+  sky130_fd_sc_hd__and2_1 _0232_ (
+    .A(_0183_),
+    .B(_0125_),
+    .X(_0231_)
+  );
+  sky130_fd_sc_hd__or2_1 _0234_ (
+    .A(_0231_),
+    .B(_0185_),
+    .X(_0233_)
+  );
+  sky130_fd_sc_hd__or2_1 _0236_ (
+    .A(_0187_),
+    .B(_0193_),
+    .X(_0235_)
+  );
+  sky130_fd_sc_hd__and2_1 _0238_ (
+    .A(_0187_),
+    .B(_0193_),
+    .X(_0237_)
+  );
+  sky130_fd_sc_hd__or3_1 _0240_ (
+    .A(_0237_),
+    .B(_0191_),
+    .C(_0197_),
+    .X(_0239_)
+  );
+  sky130_fd_sc_hd__or2_1 _0242_ (
+    .A(_0199_),
+    .B(_0205_),
+    .X(_0241_)
+  );
+  sky130_fd_sc_hd__and2_1 _0244_ (
+    .A(_0199_),
+    .B(_0205_),
+    .X(_0243_)
+  );
+  sky130_fd_sc_hd__or3_1 _0246_ (
+    .A(_0243_),
+    .B(_0203_),
+    .C(_0209_),
+    .X(_0245_)
+  );
+  sky130_fd_sc_hd__or2_1 _0248_ (
+    .A(_0211_),
+    .B(_0217_),
+    .X(_0247_)
+  );
+  sky130_fd_sc_hd__and2_1 _0250_ (
+    .A(_0211_),
+    .B(_0217_),
+    .X(_0249_)
+  );
+  sky130_fd_sc_hd__or3_1 _0252_ (
+    .A(_0249_),
+    .B(_0215_),
+    .C(_0221_),
+    .X(_0251_)
+  );
+  sky130_fd_sc_hd__or2_1 _0254_ (
+    .A(_0223_),
+    .B(_0229_),
+    .X(_0253_)
+  );
+  sky130_fd_sc_hd__and2_1 _0256_ (
+    .A(_0223_),
+    .B(_0229_),
+    .X(_0255_)
+  );
+  sky130_fd_sc_hd__or3_1 _0258_ (
+    .A(_0255_),
+    .B(_0227_),
+    .C(_0233_),
+    .X(_0257_)
+  );
+  sky130_fd_sc_hd__or2_1 _0260_ (
+    .A(_0235_),
+    .B(_0241_),
+    .X(_0259_)
+  );
+  sky130_fd_sc_hd__and2_1 _0262_ (
+    .A(_0235_),
+    .B(_0241_),
+    .X(_0261_)
+  );
+  sky130_fd_sc_hd__or3_1 _0264_ (
+    .A(_0261_),
+    .B(_0239_),
+    .C(_0245_),
+    .X(_0263_)
+  );
+  sky130_fd_sc_hd__or2_1 _0266_ (
+    .A(_0247_),
+    .B(_0253_),
+    .X(_0265_)
+  );
+  sky130_fd_sc_hd__and2_1 _0268_ (
+    .A(_0247_),
+    .B(_0253_),
+    .X(_0267_)
+  );
+  sky130_fd_sc_hd__or3_1 _0270_ (
+    .A(_0267_),
+    .B(_0251_),
+    .C(_0257_),
+    .X(_0269_)
+  );
+  sky130_fd_sc_hd__or2_1 _0272_ (
+    .A(_0259_),
+    .B(_0265_),
+    .X(_0271_)
+  );
+  sky130_fd_sc_hd__and2_1 _0274_ (
+    .A(_0259_),
+    .B(_0265_),
+    .X(_0273_)
+  );
+  sky130_fd_sc_hd__or3_1 _0276_ (
+    .A(_0273_),
+    .B(_0263_),
+    .C(_0269_),
+    .X(_0275_)
+  );
+  sky130_fd_sc_hd__inv_1 _0278_ (
+    .A(_0275_),
+    .Y(_0277_)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0279_ (
+    .CLK(clk),
+    .D(_0277_),
+    .Q(o_is_unary)
+  );
+  sky130_fd_sc_hd__dfxtp_1 _0280_ (
+    .CLK(clk),
+    .D(_0032_),
+    .Q(o_is_compliment)
+  );
+endmodule
@@ -0,0 +1,112 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include "plugins.h"
+
+#include <dlfcn.h>
+
+#include <filesystem>
+#include <memory>
+
+#include "log.h"
+#include "tb.h"
+
+namespace tb {
+
+#define U_TB_STRINGIFY_(__x) #__x
+#define U_TB_STRINGIFY(__x) U_TB_STRINGIFY_(__x)
+
+namespace {
+
+// Plugins resolve testbench state (OPTIONS, and the logger) against the
+// global symbols of the process. The driver exports its own (see:
+// tb/CMakeLists.txt); where the testbench is itself a module loaded with
+// local scope (as are the Python bindings), the module is promoted to global
+// scope, such that plugins bind to its state rather than to copies of their
+// own.
+bool export_testbench() {
+  static const bool exported = [] {
+    Dl_info info;
+    if ((dladdr(std::addressof(OPTIONS), &info) == 0) ||
+        (info.dli_fname == nullptr)) {
+      return false;
+    }
+    return dlopen(info.dli_fname, RTLD_NOW | RTLD_NOLOAD | RTLD_GLOBAL) !=
+           nullptr;
+  }();
+  return exported;
+}
+
+}  // namespace
+
+bool load_plugin(const std::string& path, std::string& error) {
+  export_testbench();
+
+  // Plugins are never unloaded; designs constructed from a plugin may
+  // outlive any particular point at which it would be safe to do so.
+  void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (handle == nullptr) {
+    error = dlerror();
+    return false;
+  }
+
+  auto entry = reinterpret_cast<PluginEntry>(
+      dlsym(handle, U_TB_STRINGIFY(U_TB_PLUGIN_ENTRY)));
+  if (entry == nullptr) {
+    error = path + ": not a design plugin";
+    return false;
+  }
+
+  const char* name = nullptr;
+  std::unique_ptr<DesignRegistry::DesignBuilderBase> b{entry(&name)};
+  U_LOG_INFO("Loaded design \"", name, "\" from plugin: ", path);
+  DESIGN_REGISTRY.add(name, std::move(b));
+  return true;
+}
+
+bool load_plugin_dir(const std::string& path, std::string& error) {
+  std::error_code ec;
+  for (const auto& e : std::filesystem::directory_iterator(path, ec)) {
+    const std::filesystem::path& p{e.path()};
+    if (!e.is_regular_file() || (p.extension() != ".so")) {
+      continue;
+    }
+    if (!load_plugin(p.string(), error)) {
+      return false;
+    }
+  }
+  if (ec) {
+    error = path + ": " + ec.message();
+    return false;
+  }
+  return true;
+}
+
+#undef U_TB_STRINGIFY
+#undef U_TB_STRINGIFY_
+
+}  // namespace tb
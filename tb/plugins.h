@@ -0,0 +1,53 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_PLUGINS_H
+#define TB_PLUGINS_H
+
+#include <string>
+
+#include "designs.h"
+
+// Entry point exported (with C linkage) by each design plugin. Returns a
+// heap-allocated builder for the design, whose name is written to 'name';
+// ownership of the builder passes to the caller.
+#define U_TB_PLUGIN_ENTRY u_tb_design_plugin
+
+namespace tb {
+
+using PluginEntry = DesignRegistry::DesignBuilderBase* (*)(const char** name);
+
+// Load the design plugin at 'path' and add its builder to the design
+// registry. On failure, returns false and sets 'error'.
+bool load_plugin(const std::string& path, std::string& error);
+
+// Load all design plugins found in directory 'path'.
+bool load_plugin_dir(const std::string& path, std::string& error);
+
+}  // namespace tb
+
+#endif
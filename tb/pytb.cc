@@ -0,0 +1,142 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "batch.h"
+#include "cfg.h"
+#include "designs.h"
+#include "netlist.h"
+#include "plugins.h"
+
+namespace py = pybind11;
+
+namespace {
+
+using packed_array = py::array_t<std::uint64_t, py::array::c_style>;
+
+// Validate the shape of a packed stimulus batch and return its row count.
+std::size_t check_batch(const packed_array& x) {
+  if ((x.ndim() != 2) ||
+      (static_cast<std::size_t>(x.shape(1)) != tb::batch_stride())) {
+    throw py::value_error("expected uint64 array of shape (N, " +
+                          std::to_string(tb::batch_stride()) + ")");
+  }
+  return static_cast<std::size_t>(x.shape(0));
+}
+
+py::tuple evaluate(const std::string& design, const packed_array& x,
+                   std::size_t threads) {
+  const std::size_t n = check_batch(x);
+  py::array_t<bool> is_unary(n), is_compliment(n);
+
+  bool ok = false;
+  {
+    py::gil_scoped_release release;
+    ok = tb::evaluate_batch(design, x.data(), n, is_unary.mutable_data(),
+                            is_compliment.mutable_data(), threads);
+  }
+  if (!ok) {
+    throw py::key_error("unknown design: " + design);
+  }
+  return py::make_tuple(is_unary, is_compliment);
+}
+
+py::tuple golden(const packed_array& x, std::size_t threads) {
+  const std::size_t n = check_batch(x);
+  py::array_t<bool> is_unary(n), is_compliment(n);
+  {
+    py::gil_scoped_release release;
+    tb::evaluate_batch_golden(x.data(), n, is_unary.mutable_data(),
+                              is_compliment.mutable_data(), threads);
+  }
+  return py::make_tuple(is_unary, is_compliment);
+}
+
+}  // namespace
+
+PYBIND11_MODULE(u_tb, m) {
+  m.doc() = "Unary-/Thermometer admission circuit batch evaluation.";
+
+  m.attr("W") = tb::cfg::W;
+  m.attr("ADMIT_COMPLIMENT") = tb::cfg::ADMIT_COMPLIMENT;
+
+  if (tb::cfg::DESIGN_PLUGINS) {
+    std::string error;
+    if (!tb::load_plugin_dir(tb::cfg::PLUGIN_DIR, error)) {
+      throw py::import_error(error);
+    }
+  }
+
+  m.def(
+      "load_plugin",
+      [](const std::string& path) {
+        std::string error;
+        if (!tb::load_plugin(path, error)) {
+          throw py::import_error(error);
+        }
+      },
+      py::arg("path"), "Load design plugin (shared object).");
+
+  m.def(
+      "load_netlist",
+      [](const std::string& name, const std::string& path,
+         const std::string& liberty) {
+        std::string error;
+        if (!tb::register_netlist(name, path, liberty, error)) {
+          throw py::value_error(error);
+        }
+      },
+      py::arg("name"), py::arg("path"), py::arg("liberty"),
+      "Load synthesized netlist as design 'name'.");
+
+  m.def(
+      "designs",
+      []() {
+        std::vector<std::string> vs;
+        tb::DESIGN_REGISTRY.designs(std::back_inserter(vs));
+        return vs;
+      },
+      "List available designs.");
+
+  // Arrays are taken by reference ('noconvert'), a mismatched dtype or
+  // layout is rejected rather than silently copied.
+  m.def("evaluate", &evaluate, py::arg("design"), py::arg("x").noconvert(),
+        py::arg("threads") = 0,
+        "Evaluate packed vectors x[N, ceil(W/64)] on design; returns "
+        "(is_unary[N], is_compliment[N]).");
+
+  m.def("golden", &golden, py::arg("x").noconvert(), py::arg("threads") = 0,
+        "Evaluate packed vectors x[N, ceil(W/64)] on the behavioral model.");
+}
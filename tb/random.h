@@ -38,7 +38,13 @@ inline class Random {
   explicit Random(seed_type s = seed_type{}) { seed(s); }
 
   // Set seed of randomization engine.
-  void seed(seed_type s) { mt_.seed(s); }
+  void seed(seed_type s) {
+    seed_ = s;
+    mt_.seed(s);
+  }
+
+  // Seed of randomization engine.
+  seed_type seed() const noexcept { return seed_; }
 
   // Generate a random integral type in range [lo, hi]
   template <typename T>
@@ -62,6 +68,7 @@ inline class Random {
   }
 
  private:
+  seed_type seed_;
   std::mt19937 mt_;
 } RANDOM;
 
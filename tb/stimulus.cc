@@ -26,6 +26,9 @@
 //========================================================================== //
 
 #include "stimulus.h"
+
+#include <string>
+
 #include "random.h"
 #include "cfg.h"
 
@@ -90,4 +93,49 @@ std::tuple<bool, StimulusVector> generate_non_unary(std::size_t rounds_n) {
   return {false, StimulusVector{}};
 }
 
+bool parse_vector(std::string_view s, StimulusVector& v) {
+  if (const std::size_t i = s.find("'b"); i != std::string_view::npos) {
+    s.remove_prefix(i + 2);
+  }
+
+  std::string bits;
+  for (const char c : s) {
+    if (c == '0' || c == '1') {
+      bits.push_back(c);
+    } else if (c != '_' && c != ' ' && c != '\t' && c != '\r') {
+      return false;
+    }
+  }
+  if (bits.size() != StimulusVector::size()) {
+    return false;
+  }
+
+  v.clear();
+  for (std::size_t i = 0; i < bits.size(); i++) {
+    v.bit(bits.size() - i - 1, bits[i] == '1');
+  }
+  return true;
+}
+
+StimulusVector StimulusStream::next() {
+  const vluint64_t r = mt_();
+
+  // One in four vectors is a (possibly complimented) unary encoding.
+  if ((r & 0x3) == 0) {
+    return generate_unary((r >> 8) % StimulusVector::size(), (r >> 2) & 0x1);
+  }
+
+  // Otherwise, fully random.
+  StimulusVector v;
+  vluint64_t w = 0;
+  for (std::size_t i = 0; i < v.size_bytes_n(); i++, w >>= 8) {
+    if ((i % sizeof(vluint64_t)) == 0) {
+      w = mt_();
+    }
+    v.value(i, static_cast<StimulusVector::value_type>(w));
+  }
+  v.clean();
+  return v;
+}
+
 }  // namespace tb
\ No newline at end of file
@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <array>
 #include <ostream>
+#include <random>
 #include <tuple>
 
 #include "cfg.h"
@@ -44,7 +45,7 @@ template <std::size_t W, typename T = vluint8_t>
 class VBitVector {
   static constexpr std::size_t size_in_bits_n = W;
   static constexpr std::size_t size_in_bytes_n = ceil(size_in_bits_n, 8);
-  static constexpr std::size_t bits_in_tail_n = (W % sizeof(T));
+  static constexpr std::size_t bits_in_tail_n = (W % (8 * sizeof(T)));
 
  public:
   using value_type = T;
@@ -61,7 +62,7 @@ class VBitVector {
 
   explicit VBitVector() { clear(); }
 
-  explicit VBitVector(vluint8_t* d, std::size_t n) {
+  explicit VBitVector(const vluint8_t* d, std::size_t n) {
     clear();
     std::copy_n(d, std::min(n, size_bytes_n()), v_.data());
   }
@@ -181,6 +182,24 @@ StimulusVector generate_unary(std::size_t n, bool compliment = false);
 
 std::tuple<bool, StimulusVector> generate_non_unary(std::size_t rounds_n = 1);
 
+// Parse vector from its rendered form (MSB first, with optional "<W>'b"
+// prefix and '_' separators). Fails if the width is not exactly W.
+bool parse_vector(std::string_view s, StimulusVector& v);
+
+// Deterministic mix of unary and random vectors, a function of its seed
+// alone. Independent of the global randomization engine (and of the
+// standard library's distributions) such that a stream can be reproduced
+// exactly, across runs and across builds.
+class StimulusStream {
+ public:
+  explicit StimulusStream(vluint64_t seed) : mt_(seed) {}
+
+  StimulusVector next();
+
+ private:
+  std::mt19937_64 mt_;
+};
+
 }  // namespace tb
 
 #endif
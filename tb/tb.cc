@@ -33,7 +33,11 @@
 #include <iterator>
 #include "verilated_vcd_c.h"
 
+#include "activity.h"
+#include "cfg.h"
 #include "designs.h"
+#include "netlist.h"
+#include "plugins.h"
 #include "random.h"
 #include "tests.h"
 
@@ -53,7 +57,8 @@ class Scenario {
 
   void add(std::unique_ptr<TestCase>&& t) { ts_.push_back(std::move(t)); }
 
-  void run();
+  // Run all tests on design; returns false if any test failed.
+  bool run();
 
   TestCase* head() const {
     if (ts_.empty())
@@ -70,11 +75,13 @@ class Scenario {
   std::vector<std::unique_ptr<TestCase> > ts_;
 };
 
-void Scenario::run() {
+bool Scenario::run() {
+  bool pass = true;
   for (auto& t : ts_) {
     U_LOG_INFO("Scenario: design=\"", d_->name(), "\" test=\"", t->name(), "\"");
-    t->run(d_.get());
+    pass &= t->run(d_.get());
   }
+  return pass;
 }
 
 class Program {
@@ -83,23 +90,26 @@ class Program {
 
   void add(std::unique_ptr<Scenario>&& s) { s_.push_back(std::move(s)); }
 
-  void run();
+  // Run all scenarios; returns false if any scenario failed.
+  bool run();
 
  private:
-  void run_scenario(Scenario* s);
+  bool run_scenario(Scenario* s);
 
   std::vector<std::unique_ptr<Scenario> > s_;
 };
 
-void Program::run() {
+bool Program::run() {
+  bool pass = true;
   for (std::unique_ptr<Scenario>& s : s_) {
-    run_scenario(s.get());
+    pass &= run_scenario(s.get());
   }
+  return pass;
 }
 
-void Program::run_scenario(Scenario* s) {
+bool Program::run_scenario(Scenario* s) {
   // Run-test on current design.
-  s->run();
+  return s->run();
 }
 
 struct DriverRuntime {
@@ -111,6 +121,11 @@ struct DriverRuntime {
 
  private:
   void build(std::vector<std::string_view>& args, std::ostream& os);
+  void load_plugins(const std::vector<std::string_view>& plugins,
+                    const std::vector<std::string_view>& plugin_dirs,
+                    std::ostream& os);
+  void load_netlists(const std::vector<std::string_view>& netlists,
+                     const std::string_view& liberty, std::ostream& os);
   void help() const;
   void parse_test_arg_string(const std::string_view vs);
 
@@ -125,12 +140,26 @@ DriverRuntime::DriverRuntime(int argc, const char** argv, std::ostream& os) {
 }
 
 int DriverRuntime::run() const {
-  p_->run();
+  if (!p_->run()) {
+    // One or more tests failed.
+    return 1;
+  }
+  if (!OPTIONS.activity_file.empty()) {
+    if (std::string error; !ACTIVITY.write(OPTIONS.activity_file, error)) {
+      std::cerr << error << "\n";
+      return 1;
+    }
+  }
   return status();
 }
 
 void DriverRuntime::build(std::vector<std::string_view>& args,
                           std::ostream& os) {
+  // Scenarios are constructed once all designs have been loaded.
+  std::vector<std::string_view> scenarios, plugins, plugin_dirs, netlists;
+  std::string_view liberty;
+  bool list_designs = false;
+
   for (std::size_t i = 1; i < args.size(); ++i) {
     const std::string_view arg{args[i]};
 
@@ -144,12 +173,7 @@ void DriverRuntime::build(std::vector<std::string_view>& args,
 
     // Parse arguments.
     if (arg == "--list_designs") {
-      std::vector<std::string> vs;
-      DESIGN_REGISTRY.designs(std::back_inserter(vs));
-      for (const std::string& design : vs) {
-        std::cout << design << std::endl;
-      }
-      std::exit(0);
+      list_designs = true;
     } else if (arg == "--list_tests") {
       std::vector<std::string> vs;
       TEST_REGISTRY.tests(std::back_inserter(vs));
@@ -169,16 +193,98 @@ void DriverRuntime::build(std::vector<std::string_view>& args,
       OPTIONS.debug = true;
     } else if (arg == "-t" || arg == "--test") {
       check_next_argument();
-      parse_test_arg_string(args[++i]);
+      scenarios.push_back(args[++i]);
+    } else if (arg == "--plugin") {
+      check_next_argument();
+      plugins.push_back(args[++i]);
+    } else if (arg == "--plugin_dir") {
+      check_next_argument();
+      plugin_dirs.push_back(args[++i]);
+    } else if (arg == "--netlist") {
+      check_next_argument();
+      netlists.push_back(args[++i]);
+    } else if (arg == "--liberty") {
+      check_next_argument();
+      liberty = args[++i];
     } else if (arg == "-h" || arg == "--help") {
       help();
     } else if (arg == "--vcd") {
       OPTIONS.vcd_en = true;
+    } else if (arg == "--signature_file") {
+      check_next_argument();
+      OPTIONS.signature_file = args[++i];
+    } else if (arg == "--signature_update") {
+      OPTIONS.signature_update = true;
+    } else if (arg == "--activity") {
+      check_next_argument();
+      OPTIONS.activity_file = args[++i];
     } else {
       os << "Invalid command line option: " << arg << "\n";
       help();
     }
   }
+
+  load_plugins(plugins, plugin_dirs, os);
+  load_netlists(netlists, liberty, os);
+
+  if (list_designs) {
+    std::vector<std::string> vs;
+    DESIGN_REGISTRY.designs(std::back_inserter(vs));
+    for (const std::string& design : vs) {
+      std::cout << design << std::endl;
+    }
+    std::exit(0);
+  }
+
+  for (const std::string_view& scenario : scenarios) {
+    parse_test_arg_string(scenario);
+  }
+}
+
+void DriverRuntime::load_plugins(
+    const std::vector<std::string_view>& plugins,
+    const std::vector<std::string_view>& plugin_dirs, std::ostream& os) {
+  std::string error;
+  auto fail = [&]() {
+    os << "Unable to load design plugin: " << error << "\n";
+    std::exit(1);
+  };
+
+  for (const std::string_view& plugin : plugins) {
+    if (!load_plugin(std::string{plugin}, error)) fail();
+  }
+  for (const std::string_view& plugin_dir : plugin_dirs) {
+    if (!load_plugin_dir(std::string{plugin_dir}, error)) fail();
+  }
+
+  // Otherwise, fall back to the designs built alongside the driver.
+  if (cfg::DESIGN_PLUGINS && plugins.empty() && plugin_dirs.empty()) {
+    if (!load_plugin_dir(cfg::PLUGIN_DIR, error)) fail();
+  }
+}
+
+void DriverRuntime::load_netlists(const std::vector<std::string_view>& netlists,
+                                  const std::string_view& liberty,
+                                  std::ostream& os) {
+  if (!netlists.empty() && liberty.empty()) {
+    os << "Argument --netlist requires --liberty." << std::endl;
+    std::exit(1);
+  }
+
+  for (const std::string_view& netlist : netlists) {
+    auto [ok, name, path] = split_kv(netlist);
+    std::string error;
+    if (!ok) {
+      os << "Malformed netlist argument (expected <name>=<path>): " << netlist
+         << std::endl;
+      std::exit(1);
+    }
+    if (!register_netlist(std::string{name}, std::string{path},
+                          std::string{liberty}, error)) {
+      os << "Unable to load netlist: " << error << std::endl;
+      std::exit(1);
+    }
+  }
 }
 
 void DriverRuntime::parse_test_arg_string(const std::string_view vs) {
@@ -245,9 +351,19 @@ Arguments:
 
   -h/--help            : Print Options.
      --list_designs    : List available designs
+     --plugin <path>   : Load design plugin (shared object)
+     --plugin_dir <dir>: Load all design plugins in directory
+     --netlist <name>=<path>
+                       : Load synthesized netlist as design <name>
+     --liberty <path>  : Liberty file defining netlist cells
   -s/--seed <integer>  : (Integer) Randomization seed
   -v/--verbose         : Verbosity
      --vcd             : Enable VCD tracing.
+     --signature_file <path>
+                       : Signature file (SignatureTestCase)
+     --signature_update: Record new signatures (SignatureTestCase)
+     --activity <path> : Write switching activity of applied stimulus
+                         (OpenSTA set_power_activity commands)
   )";
   std::exit(1);
 }
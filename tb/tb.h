@@ -28,6 +28,9 @@
 #ifndef TB_TB_H
 #define TB_TB_H
 
+#include <memory>
+#include <string>
+
 #include "common.h"
 #include "log.h"
 
@@ -50,7 +53,16 @@ inline struct Options {
   // Enable VCD tracing.
   bool vcd_en = false;
 
-} OPTIONS;
+  // Stored per-design signatures (see: SignatureTestCase).
+  std::string signature_file = "signatures.txt";
+
+  // Record signatures rather than check against those stored.
+  bool signature_update = false;
+
+  // Write switching activity of applied stimulus (see: Activity).
+  std::string activity_file;
+
+} OPTIONS U_EXPORT;
 
 }  // namespace tb
 
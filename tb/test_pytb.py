@@ -0,0 +1,144 @@
+##========================================================================== //
+## Copyright (c) 2025, Stephen Henry
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and/or other materials provided with the distribution.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##========================================================================== //
+
+# Python bindings (see: tb/pytb.cc) regression: each design evaluates a
+# batch as does the behavioral model, and the behavioral model agrees with
+# an independent model of vectors packed as documented (rows of
+# ceil(W/64) 64b words, least significant word and bit first). Where
+# designs are built as plugins (U_TB_PLUGIN_DIR), each is also loaded
+# explicitly through the bindings.
+
+import os
+import pathlib
+import sys
+
+import numpy as np
+
+import u_tb
+
+W = u_tb.W
+WORDS = (W + 63) // 64
+MASK = (1 << W) - 1
+
+def pack(vs: list) -> np.ndarray:
+    x = np.zeros((len(vs), WORDS), dtype=np.uint64)
+    for i, v in enumerate(vs):
+        for j in range(WORDS):
+            x[i, j] = (v >> (64 * j)) & ((1 << 64) - 1)
+    return x
+
+def model(v: int) -> tuple:
+    # At most one edge; complimented (MSB set) codes only where admitted.
+    msb = bool((v >> (W - 1)) & 1)
+    edges = bin((v ^ (v >> 1)) & ((1 << (W - 1)) - 1)).count('1')
+    is_unary = (edges <= 1) and (u_tb.ADMIT_COMPLIMENT or not msb)
+    return (is_unary, u_tb.ADMIT_COMPLIMENT and msb)
+
+def stimulus(n: int) -> list:
+    # Unary codes (and their compliments) of each length, codes with a
+    # single bit flipped, and random vectors.
+    rng = np.random.default_rng(1)
+    vs = []
+    for k in range(W + 1):
+        v = (1 << k) - 1
+        vs += [v, v ^ MASK]
+        vs += [v ^ (1 << int(rng.integers(W)))]
+    while len(vs) < n:
+        v = 0
+        for j in range(WORDS):
+            v |= int(rng.integers(1 << 64, dtype=np.uint64)) << (64 * j)
+        vs.append(v & MASK)
+    return vs
+
+def load_plugins(path: str) -> int:
+    # Loading is idempotent (plugins are already loaded at import), and
+    # registers the plugin's design; a shared object which is not a plugin
+    # is rejected.
+    failed = 0
+    plugins = sorted(pathlib.Path(path).glob('*.so'))
+    if not plugins:
+        print(f'load_plugin: no plugins in {path}')
+        return 1
+    for p in plugins:
+        design = p.stem.removeprefix('lib').removeprefix('tb_design_')
+        try:
+            u_tb.load_plugin(str(p))
+        except ImportError as e:
+            print(f'load_plugin: {e}')
+            failed += 1
+            continue
+        if design not in u_tb.designs():
+            print(f'load_plugin: {p.name} did not register {design}')
+            failed += 1
+    try:
+        u_tb.load_plugin(u_tb.__file__)
+        print('load_plugin: accepted module without plugin entry')
+        failed += 1
+    except ImportError:
+        pass
+    return failed
+
+def main() -> int:
+    vs = stimulus(4096)
+    x = pack(vs)
+    failed = 0
+
+    if (plugin_dir := os.environ.get('U_TB_PLUGIN_DIR')):
+        failed += load_plugins(plugin_dir)
+
+    is_unary, is_compliment = u_tb.golden(x)
+    for i, v in enumerate(vs):
+        if (bool(is_unary[i]), bool(is_compliment[i])) != model(v):
+            print(f'golden: mismatch on {v:#x}')
+            failed += 1
+            break
+
+    for design in u_tb.designs():
+        actual_is_unary, actual_is_compliment = \
+            u_tb.evaluate(design, x, threads=2)
+        mismatches = np.flatnonzero((actual_is_unary != is_unary) |
+                                    (actual_is_compliment != is_compliment))
+        if mismatches.size:
+            print(f'{design}: mismatch on {vs[mismatches[0]]:#x}')
+            failed += 1
+
+    # Arrays of another shape or type are rejected rather than converted.
+    for bad, error in ((x[:, :0], ValueError),
+                       (x.astype(np.int64), TypeError)):
+        try:
+            u_tb.golden(bad)
+            print(f'golden: accepted array of {bad.dtype}{bad.shape}')
+            failed += 1
+        except error:
+            pass
+
+    print(f'{len(u_tb.designs())} designs, {len(vs)} vectors: '
+          f'{"FAIL" if failed else "PASS"}')
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
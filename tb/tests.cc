@@ -27,6 +27,12 @@
 
 #include "tests.h"
 
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#include "activity.h"
 #include "designs.h"
 #include "log.h"
 #include "random.h"
@@ -38,8 +44,42 @@ namespace tb {
 bool TestCase::check(DesignBase* b, const StimulusVector& v) {
   U_LOG_SCOPE(0);
   U_LOG_INFO("Trial: ", v);
+  if (!OPTIONS.activity_file.empty()) {
+    ACTIVITY.record(v);
+  }
+
+  return check_response(v, b->is_unary(v));
+}
+
+bool TestCase::check_stream(DesignBase* b,
+                            const std::vector<StimulusVector>& vs) {
+  const std::vector<std::tuple<bool, bool> > rs{b->is_unary_stream(vs)};
+  if (!OPTIONS.activity_file.empty()) {
+    for (const StimulusVector& v : vs) {
+      ACTIVITY.record(v);
+    }
+  }
+  if (rs.size() != vs.size()) {
+    U_LOG_ERROR("Design responded to ", std::to_string(rs.size()), " of ",
+                std::to_string(vs.size()), " vectors.");
+    ++mismatches_;
+    return false;
+  }
+
+  for (std::size_t i = 0; i < vs.size(); i++) {
+    U_LOG_SCOPE(0);
+    U_LOG_INFO("Trial: ", vs[i]);
+
+    if (!check_response(vs[i], rs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
 
-  auto [rtl_is_unary, rtl_is_compliment] = b->is_unary(v);
+bool TestCase::check_response(const StimulusVector& v,
+                              const std::tuple<bool, bool>& rtl) {
+  auto [rtl_is_unary, rtl_is_compliment] = rtl;
   auto [beh_is_unary, beh_is_compliment] = is_unary(v);
 
   U_LOG_SCOPE(1);
@@ -134,9 +174,8 @@ class FullyRandomizedTestCase : public TestCase {
     } else {
       // Random, non-unary vector.
       auto [success, v] = generate_non_unary();
-      if (success) {
-        pass = check(b, v);
-      }
+      // Generation may fail for small W; the trial is then skipped.
+      pass = !success || check(b, v);
     }
     return pass;
   }
@@ -186,4 +225,231 @@ class DirectedExhaustiveTestCase : public TestCase {
 };
 DECLARE_TESTCASE(DirectedExhaustiveTestCase);
 
+// Randomized stimulus presented back-to-back, at full throughput, to
+// exercise pipelined designs; the responses of stallable designs are
+// refused at random, to exercise backpressure.
+class StreamingRandomizedTestCase : public TestCase {
+ public:
+  explicit StreamingRandomizedTestCase()
+      : TestCase("StreamingRandomizedTestCase") {}
+
+  // Parameters:
+
+  // Trial count (option: o=<n>)
+  std::size_t param_n = 1000;
+
+  // Probability that a response is refused on any cycle.
+  static constexpr float param_stall_prob = 0.25f;
+
+  void config(const std::string_view& sv) override {
+    param_n = std::stoull(std::string{sv});
+  }
+
+  bool run(DesignBase* b) override {
+    StimulusStream ss{RANDOM.uniform<Random::seed_type>()};
+    std::vector<StimulusVector> vs;
+    vs.reserve(param_n);
+    for (std::size_t i = 0; i < param_n; i++) {
+      vs.push_back(ss.next());
+    }
+    b->set_stall_probability(param_stall_prob);
+    const bool pass = check_stream(b, vs);
+    b->set_stall_probability(0.0f);
+    return pass;
+  }
+};
+DECLARE_TESTCASE(StreamingRandomizedTestCase);
+
+// Replay of previously recorded vectors, one per line (for example, the
+// counterexample emitted by a failing equivalence proof).
+class ReplayTestCase : public TestCase {
+ public:
+  explicit ReplayTestCase() : TestCase("ReplayTestCase") {}
+
+  // Parameters:
+
+  // Vector file (option: o=<path>)
+  std::string param_fn;
+
+  void config(const std::string_view& sv) override { param_fn = sv; }
+
+  bool run(DesignBase* b) override {
+    std::ifstream is{param_fn};
+    if (!is) {
+      U_LOG_ERROR("Unable to open vector file: ", param_fn);
+      return false;
+    }
+
+    std::string line;
+    for (std::size_t n = 1; std::getline(is, line); n++) {
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+      StimulusVector v;
+      if (!parse_vector(line, v)) {
+        U_LOG_ERROR("Malformed vector at ", param_fn, ":", std::to_string(n),
+                    ": ", line);
+        return false;
+      }
+      if (!check(b, v)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+DECLARE_TESTCASE(ReplayTestCase);
+
+// Multiple-Input Signature Register; folds a stream of design responses into
+// a single 64b signature.
+class Misr {
+ public:
+  // Feedback polynomial: x^64 + x^4 + x^3 + x + 1
+  static constexpr vluint64_t poly = 0x1B;
+
+  void fold(vluint64_t r) noexcept {
+    sig_ = ((sig_ << 1) ^ ((sig_ >> 63) ? poly : 0)) ^ r;
+  }
+
+  vluint64_t signature() const noexcept { return sig_; }
+
+ private:
+  vluint64_t sig_ = 0;
+};
+
+// Store of signatures, one record per line: "<key> <signature>".
+class SignatureFile {
+ public:
+  explicit SignatureFile(const std::string& fn) : fn_(fn) {
+    std::ifstream is{fn_};
+    std::string key;
+    vluint64_t sig;
+    while (is >> key >> std::hex >> sig) {
+      sigs_[key] = sig;
+    }
+  }
+
+  bool find(const std::string& key, vluint64_t& sig) const {
+    if (auto it = sigs_.find(key); it != sigs_.end()) {
+      sig = it->second;
+      return true;
+    }
+    return false;
+  }
+
+  void set(const std::string& key, vluint64_t sig) { sigs_[key] = sig; }
+
+  bool write() const {
+    std::ofstream os{fn_};
+    for (const auto& [key, sig] : sigs_) {
+      os << key << " " << to_string(sig) << "\n";
+    }
+    return os.good();
+  }
+
+  static std::string to_string(vluint64_t sig) {
+    std::ostringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << sig;
+    return ss.str();
+  }
+
+ private:
+  std::string fn_;
+  std::map<std::string, vluint64_t> sigs_;
+};
+
+// Regression against the behavior of a prior build. Design responses to a
+// seed-determined stimulus stream are folded into a signature, which is
+// compared against that previously recorded for the design. The behavioral
+// model is consulted only when signatures differ, to locate the first
+// divergent vector.
+class SignatureTestCase : public TestCase {
+ public:
+  explicit SignatureTestCase() : TestCase("SignatureTestCase") {}
+
+  // Parameters:
+
+  // Trial count (option: o=<n>)
+  std::size_t param_n = 1 << 16;
+
+  void config(const std::string_view& sv) override {
+    param_n = std::stoull(std::string{sv});
+  }
+
+  bool run(DesignBase* b) override {
+    // Stream is a function of the global seed and design alone, such that
+    // it is unaffected by other scenarios on the command line.
+    const vluint64_t seed = stream_seed(RANDOM.seed(), b->name());
+
+    Misr misr;
+    StimulusStream ss{seed};
+    for (std::size_t i = 0; i < param_n; i++) {
+      auto [is_unary, is_compliment] = b->is_unary(ss.next());
+      misr.fold((is_unary ? 0b01 : 0b00) | (is_compliment ? 0b10 : 0b00));
+    }
+    const vluint64_t actual = misr.signature();
+
+    std::ostringstream key;
+    key << "design=" << b->name() << ",W=" << cfg::W
+        << ",admit_compliment=" << cfg::ADMIT_COMPLIMENT << ",seed=" << seed
+        << ",n=" << param_n;
+
+    SignatureFile sf{OPTIONS.signature_file};
+    vluint64_t expected = 0;
+    const bool found = sf.find(key.str(), expected);
+    if (found && (expected == actual)) {
+      U_LOG_INFO("Signature match: ", SignatureFile::to_string(actual));
+      return true;
+    }
+
+    if (found) {
+      U_LOG_ERROR("Signature mismatch: expected=",
+                  SignatureFile::to_string(expected),
+                  " actual=", SignatureFile::to_string(actual));
+    } else {
+      U_LOG_WARNING("No signature recorded for: ", key.str());
+    }
+
+    // Replay stream against the behavioral model.
+    const bool pass = locate_divergence(b, seed);
+    if (pass && OPTIONS.signature_update) {
+      U_LOG_INFO("Recording signature: ", SignatureFile::to_string(actual));
+      sf.set(key.str(), actual);
+      if (!sf.write()) {
+        U_LOG_ERROR("Unable to write signature file: ", OPTIONS.signature_file);
+        return false;
+      }
+      return true;
+    }
+    if (pass && found) {
+      U_LOG_ERROR(
+          "No divergence from behavioral model; signature file is stale.");
+      return false;
+    }
+    return pass;
+  }
+
+ private:
+  static vluint64_t stream_seed(vluint64_t seed, const std::string& name) {
+    // FNV-1a
+    vluint64_t h = 0xcbf29ce484222325ull ^ seed;
+    for (const char c : name) {
+      h = (h ^ static_cast<vluint8_t>(c)) * 0x100000001b3ull;
+    }
+    return h;
+  }
+
+  bool locate_divergence(DesignBase* b, vluint64_t seed) {
+    StimulusStream ss{seed};
+    for (std::size_t i = 0; i < param_n; i++) {
+      if (!check(b, ss.next())) {
+        U_LOG_ERROR("First divergence at vector: ", std::to_string(i));
+        return false;
+      }
+    }
+    return true;
+  }
+};
+DECLARE_TESTCASE(SignatureTestCase);
+
 }  // namespace tb
\ No newline at end of file
@@ -30,7 +30,9 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "stimulus.h"
 
@@ -55,7 +57,13 @@ class TestCase {
  protected:
   bool check(DesignBase* b, const StimulusVector& v);
 
+  // Check stream 'vs', presented to the design back-to-back.
+  bool check_stream(DesignBase* b, const std::vector<StimulusVector>& vs);
+
  private:
+  bool check_response(const StimulusVector& v,
+                      const std::tuple<bool, bool>& rtl);
+
   std::string name_;
   std::size_t mismatches_;
 };
@@ -0,0 +1,345 @@
+//========================================================================== //
+// Copyright (c) 2025, Stephen Henry
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//========================================================================== //
+
+#ifndef TB_VDESIGN_H
+#define TB_VDESIGN_H
+
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "designs.h"
+#include "random.h"
+#include "tb.h"
+#include "verilated_vcd_c.h"
+
+namespace tb {
+
+template <typename T>
+concept VUnaryModule = requires(T t) {
+  { t.eval() } -> std::same_as<void>;
+  t.i_x;
+  t.o_is_unary;
+  t.o_is_compliment;
+};
+
+// Synchronous module; the response to a vector is presented a fixed number
+// of cycles (the latency) after the vector.
+template <typename T>
+concept VClockedModule = VUnaryModule<T> && requires(T t) { t.clk; };
+
+// Synchronous module which qualifies stimulus and response by valid/ready
+// handshakes. Responses are collected as they are accepted, and each is
+// checked to arrive exactly 'latency' cycles after its vector was accepted,
+// less those cycles in which the pipeline was stalled.
+template <typename T>
+concept VHandshakeModule = VClockedModule<T> && requires(T t) {
+  t.i_valid;
+  t.o_valid;
+};
+
+template <typename T>
+concept VResetModule = requires(T t) { t.rst; };
+
+// Module accepts stimulus only when 'o_ready' is asserted.
+template <typename T>
+concept VBackpressureModule = requires(T t) { t.o_ready; };
+
+// Module presents response only when 'i_ready' is asserted.
+template <typename T>
+concept VStallableModule = requires(T t) { t.i_ready; };
+
+template <VUnaryModule T>
+class Design : public DesignBase {
+  using response_type = std::tuple<bool, bool>;
+
+  // Cycles without a response after which a handshake module is considered
+  // to have deadlocked.
+  static constexpr std::size_t deadlock_cycles_n = 1024;
+
+ public:
+  // 'latency' is the number of cycles between a vector (or, for handshake
+  // modules, its acceptance) and its response.
+  explicit Design(const std::string& name, std::size_t latency = 0)
+      : DesignBase(name), latency_(latency) {
+    ctxt_ = std::make_unique<VerilatedContext>();
+    if constexpr (T::traceCapable) {
+      ctxt_->traceEverOn(OPTIONS.vcd_en);
+    }
+    uut_ = std::make_unique<T>(ctxt_.get(), name.c_str());
+    if constexpr (T::traceCapable) {
+      construct_trace();
+    }
+    if constexpr (VClockedModule<T>) {
+      reset();
+    }
+  }
+
+  ~Design() {
+    if constexpr (T::traceCapable) {
+      destruct_trace();
+
+    }
+  }
+
+  response_type is_unary(const StimulusVector& v) noexcept override {
+    if constexpr (VClockedModule<T>) {
+      // A deadlocked design never responds; report rejection.
+      const std::vector<response_type> rs{is_unary_stream({v})};
+      return rs.empty() ? response_type{false, false} : rs.front();
+    } else {
+      // Drive input
+      v.to_verilated(uut_->i_x);
+      // Advance simulator
+      step();
+      // Return response.
+      return sample();
+    }
+  }
+
+  std::vector<response_type> is_unary_stream(
+      const std::vector<StimulusVector>& vs) noexcept override {
+    if constexpr (VHandshakeModule<T>) {
+      return stream_handshake(vs);
+    } else if constexpr (VClockedModule<T>) {
+      return stream_fixed_latency(vs);
+    } else {
+      return DesignBase::is_unary_stream(vs);
+    }
+  }
+
+ private:
+  response_type sample() const noexcept {
+    return {VBit::from_verilated(uut_->o_is_unary).to_bool(),
+            VBit::from_verilated(uut_->o_is_compliment).to_bool()};
+  }
+
+  // Vector 'i' is driven in cycle 'i' and its response is sampled, before
+  // the rising edge, in cycle 'i + latency'.
+  std::vector<response_type> stream_fixed_latency(
+      const std::vector<StimulusVector>& vs) noexcept {
+    std::vector<response_type> rs;
+    rs.reserve(vs.size());
+    for (std::size_t c = 0; rs.size() < vs.size(); c++) {
+      if (c < vs.size()) {
+        vs[c].to_verilated(uut_->i_x);
+      }
+      step();
+      if (c >= latency_) {
+        rs.push_back(sample());
+      }
+      tick();
+    }
+    return rs;
+  }
+
+  // Vectors are issued on each cycle that the module accepts them; responses
+  // are collected on each cycle that they are valid and accepted (for a
+  // stallable module, 'i_ready' is deasserted at random with the stall
+  // probability). A response which is not accepted must be held, unchanged,
+  // and the pipeline stalled, until it is. Collection stops at the first
+  // response which is dropped, altered whilst held, presented without a
+  // vector, or which does not arrive 'latency' advancing cycles after
+  // acceptance of its vector, such that the stream is reported as
+  // incomplete.
+  std::vector<response_type> stream_handshake(
+      const std::vector<StimulusVector>& vs) noexcept {
+    std::vector<response_type> rs;
+    rs.reserve(vs.size());
+    // Count of cycles, preceding acceptance of each issued vector, in which
+    // the pipeline advanced.
+    std::vector<std::size_t> accepted_a;
+    accepted_a.reserve(vs.size());
+    std::size_t issued_n = 0, idle_n = 0, advanced_n = 0;
+    // Response presented, but not accepted, in the prior cycle.
+    std::optional<response_type> held;
+    const float stall_prob = stall_probability();
+    for (std::size_t c = 0;
+         (rs.size() < vs.size()) && (idle_n < deadlock_cycles_n); c++) {
+      const bool valid = (issued_n < vs.size());
+      uut_->i_valid = valid;
+      if (valid) {
+        vs[issued_n].to_verilated(uut_->i_x);
+      }
+      bool ready = true;
+      if constexpr (VStallableModule<T>) {
+        ready = (stall_prob <= 0.0f) || !RANDOM.random_bool(stall_prob);
+        uut_->i_ready = ready;
+      }
+      step();
+      bool accepted = valid;
+      if constexpr (VBackpressureModule<T>) {
+        accepted = accepted && (uut_->o_ready != 0);
+      }
+      if (accepted) {
+        accepted_a.push_back(advanced_n);
+        ++issued_n;
+      }
+      const bool presented = (uut_->o_valid != 0);
+      if (held && (!presented || (sample() != *held))) {
+        U_LOG_ERROR("Response ", std::to_string(rs.size()),
+                    " not held whilst stalled (cycle ", std::to_string(c),
+                    ").");
+        break;
+      }
+      if (presented && ready) {
+        if (rs.size() >= accepted_a.size()) {
+          U_LOG_ERROR("Response ", std::to_string(rs.size()),
+                      " presented without vector (cycle ", std::to_string(c),
+                      ").");
+          break;
+        }
+        if (advanced_n - accepted_a[rs.size()] != latency_) {
+          U_LOG_ERROR("Response ", std::to_string(rs.size()),
+                      " not presented ", std::to_string(latency_),
+                      " cycles after acceptance (cycle ", std::to_string(c),
+                      ").");
+          break;
+        }
+        rs.push_back(sample());
+        idle_n = 0;
+      } else {
+        ++idle_n;
+      }
+      held.reset();
+      if (presented && !ready) {
+        held = sample();
+      } else {
+        // Pipeline advances unless a response is held.
+        ++advanced_n;
+      }
+      tick();
+    }
+    uut_->i_valid = 0;
+    if constexpr (VStallableModule<T>) {
+      uut_->i_ready = 1;
+    }
+    return rs;
+  }
+
+  void reset() {
+    if constexpr (VHandshakeModule<T>) {
+      uut_->i_valid = 0;
+    }
+    if constexpr (VResetModule<T>) {
+      uut_->rst = 1;
+      for (std::size_t i = 0; i < 2; i++) {
+        step();
+        tick();
+      }
+      uut_->rst = 0;
+    }
+    step();
+  }
+
+  // Rising (then falling) clock edge; inputs are presented, and outputs
+  // sampled, whilst the clock is low.
+  void tick() {
+    if constexpr (VClockedModule<T>) {
+      uut_->clk = 1;
+      step();
+      uut_->clk = 0;
+    }
+  }
+
+  void step(std::size_t n = 1) {
+    while (n--) {
+      // Advance time
+      ctxt_->timeInc(1);
+      // Evaluate
+      uut_->eval();
+
+      if constexpr (T::traceCapable) {
+        if (OPTIONS.vcd_en) {
+          vcd_->dump(ctxt_->time());
+        }
+      }
+    }
+  }
+  void construct_trace() {
+    if (!OPTIONS.vcd_en) {
+      return;
+    }
+
+    vcd_ = std::make_unique<VerilatedVcdC>();
+    uut_->trace(vcd_.get(), 99);
+    std::ostringstream ss;
+    ss << name() << ".vcd";
+    vcd_->open(ss.str().c_str());
+  }
+
+  void destruct_trace() {
+    if (!vcd_) {
+      return;
+    }
+
+    // Append some sort rundown period at end-of-simulation to
+    // emit final parts of trace.
+    step(2);
+  
+    vcd_->close();
+  }
+
+  std::size_t latency_;
+  std::unique_ptr<VerilatedContext> ctxt_;
+  std::unique_ptr<VerilatedVcdC> vcd_;
+  std::unique_ptr<T> uut_;
+};
+
+template <typename T>
+class DesignBuilder : public tb::DesignRegistry::DesignBuilderBase {
+ public:
+  explicit DesignBuilder(const std::string& name, std::size_t latency = 0)
+      : name_(name), latency_(latency) {}
+  std::unique_ptr<DesignBase> construct() const override {
+    return std::unique_ptr<DesignBase>(new Design<T>(name_, latency_));
+  }
+
+ private:
+  std::string name_;
+  std::size_t latency_;
+};
+
+}  // namespace tb
+
+// clang-format off
+#define DECLARE_CLOCKED_DESIGN(__name, __latency)         \
+  static const struct DesignRegister##__name {            \
+    explicit DesignRegister##__name() {                   \
+      auto b = std::unique_ptr<tb::DesignRegistry::DesignBuilderBase>(\
+        new tb::DesignBuilder<V##__name>(#__name, __latency)); \
+      tb::DESIGN_REGISTRY.add(#__name, std::move(b)); \
+    }                                                     \
+  } __register_##__name {}
+
+#define DECLARE_DESIGN(__name) DECLARE_CLOCKED_DESIGN(__name, 0)
+// clang-format on
+
+#endif